@@ -4,6 +4,12 @@
 
 # ============================================================================
 #
+# 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+#
+# * Release builds are no longer tied to the instruction set of the build
+#   host, `-march=native' (`-xHost' for Intel) is added with
+#   `USE_NATIVE_ARCH' only.
+#
 # 2025-11-03 Ljubomir Kurij <ljubomir_kurij@proton.me>
 #
 # * Updated Intel compiler flags to include optimization report generation
@@ -27,13 +33,13 @@ function (set_compiler_flags)
       "-g3 -O0 -fno-omit-frame-pointer -Wall -Wextra -Wpedantic"
       )
     set (RELEASE_FLAGS
-      "-O3 -DNDEBUG -march=native -fvectorize -flto"
+      "-O3 -DNDEBUG -fvectorize -flto"
       )
     set (MINSIZEREL_FLAGS
       "-Os -DNDEBUG -ffunction-sections -fdata-sections -flto"
       )
     set (RELWITHDEBINFO_FLAGS
-      "-O2 -g -DNDEBUG -march=native -fvectorize"
+      "-O2 -g -DNDEBUG -fvectorize"
       )
     set (MINSIZEREL_LINKER_FLAGS
       "-Wl,--gc-sections -Wl,--strip-all"
@@ -47,13 +53,13 @@ function (set_compiler_flags)
       "-g3 -O0 -fno-omit-frame-pointer -Wall -Wextra -Wpedantic"
       )
     set (RELEASE_FLAGS
-      "-O3 -DNDEBUG -march=native -ftree-vectorize -flto"
+      "-O3 -DNDEBUG -ftree-vectorize -flto"
       )
     set (MINSIZEREL_FLAGS
       "-Os -DNDEBUG -ffunction-sections -fdata-sections -flto"
       )
     set (RELWITHDEBINFO_FLAGS
-      "-O2 -g -DNDEBUG -march=native -ftree-vectorize"
+      "-O2 -g -DNDEBUG -ftree-vectorize"
       )
     set (MINSIZEREL_LINKER_FLAGS
       "-Wl,--gc-sections -Wl,--strip-all"
@@ -95,7 +101,7 @@ function (set_compiler_flags)
       # Optimize for maximum speed, enable interprocedural optimization,
       # generate optimization report
       set(RELEASE_FLAGS
-        "/O3 -DNDEBUG -xHost -Qopt-report=3"
+        "/O3 -DNDEBUG -Qopt-report=3"
         )
       string(APPEND
         RELEASE_FLAGS
@@ -118,7 +124,7 @@ function (set_compiler_flags)
       # Moderate optimization with debugging info, enable interprocedural
       # optimization, generate optimization report
       set(RELWITHDEBINFO_FLAGS
-        "/O2 /debug:all -DNDEBUG -xHost -Qopt-report=3"
+        "/O2 /debug:all -DNDEBUG -Qopt-report=3"
         )
       string(APPEND
         RELWITHDEBINFO_FLAGS
@@ -133,7 +139,7 @@ function (set_compiler_flags)
       # Optimize for maximum speed, enable interprocedural optimization,
       # generate optimization report
       set(RELEASE_FLAGS
-        "-O3 -DNDEBUG -xHost -ipo -qopt-report=3"
+        "-O3 -DNDEBUG -ipo -qopt-report=3"
         )
       string(APPEND
         RELEASE_FLAGS
@@ -156,7 +162,7 @@ function (set_compiler_flags)
       # Moderate optimization with debugging info, enable interprocedural
       # optimization, generate optimization report
       set(RELWITHDEBINFO_FLAGS
-        "-O2 -g -DNDEBUG -xHost -ipo -qopt-report=3"
+        "-O2 -g -DNDEBUG -ipo -qopt-report=3"
         )
       string(APPEND
         RELWITHDEBINFO_FLAGS
@@ -165,6 +171,20 @@ function (set_compiler_flags)
     endif()
   endif()
   
+  # Optimize for the instruction set of the build host on request only, the
+  # binaries may not run on other machines then
+  if (USE_NATIVE_ARCH)
+    if (CMAKE_CXX_COMPILER_ID MATCHES "Intel")
+      set (NATIVE_ARCH_FLAG "-xHost")
+    elseif (CMAKE_CXX_COMPILER_ID MATCHES "Clang|GNU")
+      set (NATIVE_ARCH_FLAG "-march=native")
+    endif ()
+    if (DEFINED NATIVE_ARCH_FLAG)
+      string (APPEND RELEASE_FLAGS " ${NATIVE_ARCH_FLAG}")
+      string (APPEND RELWITHDEBINFO_FLAGS " ${NATIVE_ARCH_FLAG}")
+    endif ()
+  endif ()
+
   # Apply the flags to the appropriate CMake variables with PARENT_SCOPE
   # to make them available in the parent scope
   set(CMAKE_CXX_FLAGS_DEBUG "${DEBUG_FLAGS}" PARENT_SCOPE)
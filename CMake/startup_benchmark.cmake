@@ -0,0 +1,129 @@
+# =============================================================================
+# A CMake script comparing the startup latency of `cli_template_app' builds
+# =============================================================================
+
+# ============================================================================
+#
+# 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+#
+# * Created.
+# * The Release build is optimized for the build host (`USE_NATIVE_ARCH').
+# * The parent build is no longer reconfigured, `common.hxx' is configured
+#   into each build directory.
+#
+# ============================================================================
+
+# ============================================================================
+#
+# Run in script mode (normally through the `run_startup_benchmark' target):
+#
+#   cmake -DSOURCE_DIR=<source dir> -DBINARY_DIR=<build dir>
+#         -DHARNESS=<path to startup_benchmark> -DRESULTS_DIR=<dir>
+#         [-DRUNS=<N>] [-DBUILD_TYPES=MinSizeRel;Release]
+#         [-DCLIPP_SOURCE_DIR=<dir>] [-DCXX_COMPILER=<path>]
+#         -P startup_benchmark.cmake
+#
+# Builds `cli_template_app' once per build type under
+# `<build dir>/startup_benchmark/<build type>', then times each build with
+# the `startup_benchmark' harness for every scenario below. Results go to
+# `<results dir>/startup_<scenario>.json'. The Release build is optimized for
+# the build host (`-DUSE_NATIVE_ARCH=ON', i.e. `-O3 -flto -march=native'),
+# the others are portable builds.
+#
+# ============================================================================
+
+cmake_minimum_required (VERSION 3.14...3.29)
+
+foreach (required SOURCE_DIR BINARY_DIR HARNESS RESULTS_DIR)
+  if (NOT DEFINED ${required})
+    message (FATAL_ERROR "startup_benchmark: `${required}' is not set")
+  endif ()
+endforeach ()
+
+if (NOT DEFINED RUNS)
+  set (RUNS 200)
+endif ()
+if (NOT DEFINED BUILD_TYPES)
+  set (BUILD_TYPES MinSizeRel Release)
+endif ()
+
+# Reuse the sources the parent build already fetched
+set (configure_args)
+if (DEFINED CLIPP_SOURCE_DIR)
+  list (APPEND configure_args "-DFETCHCONTENT_SOURCE_DIR_CLIPP=${CLIPP_SOURCE_DIR}")
+endif ()
+if (DEFINED CXX_COMPILER)
+  list (APPEND configure_args "-DCMAKE_CXX_COMPILER=${CXX_COMPILER}")
+endif ()
+
+
+# -----------------------------------------------------------------------------
+# Build the application once per build type
+# -----------------------------------------------------------------------------
+
+set (subjects)
+foreach (build_type IN LISTS BUILD_TYPES)
+  set (build_dir "${BINARY_DIR}/startup_benchmark/${build_type}")
+  message (STATUS "Building `cli_template_app' (${build_type}) ...")
+
+  if (build_type STREQUAL "Release")
+    set (native_arch ON)
+  else ()
+    set (native_arch OFF)
+  endif ()
+
+  execute_process (
+    COMMAND ${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${build_dir}
+      -DCMAKE_BUILD_TYPE=${build_type}
+      -DUSE_NATIVE_ARCH=${native_arch}
+      -DBUILD_TESTS=OFF
+      -DBUILD_BENCHMARKS=OFF
+      ${configure_args}
+    OUTPUT_QUIET
+    RESULT_VARIABLE result
+    )
+  if (NOT result EQUAL 0)
+    message (FATAL_ERROR "startup_benchmark: configuring ${build_type} failed")
+  endif ()
+
+  execute_process (
+    COMMAND ${CMAKE_COMMAND} --build ${build_dir} --target cli_template_app
+    OUTPUT_QUIET
+    RESULT_VARIABLE result
+    )
+  if (NOT result EQUAL 0)
+    message (FATAL_ERROR "startup_benchmark: building ${build_type} failed")
+  endif ()
+
+  list (APPEND subjects "${build_type}=${build_dir}/src/cli_template_app")
+endforeach ()
+
+
+# -----------------------------------------------------------------------------
+# Time the builds
+# -----------------------------------------------------------------------------
+
+file (MAKE_DIRECTORY ${RESULTS_DIR})
+
+# Scenario name and the arguments passed to the application
+set (scenarios "default" "help")
+set (default_args "")
+set (help_args "--help")
+
+foreach (scenario IN LISTS scenarios)
+  message (STATUS "Timing the `${scenario}' scenario (${RUNS} runs) ...")
+  execute_process (
+    COMMAND ${HARNESS}
+      --runs ${RUNS}
+      --json ${RESULTS_DIR}/startup_${scenario}.json
+      ${subjects}
+      -- ${${scenario}_args}
+    RESULT_VARIABLE result
+    )
+  if (NOT result EQUAL 0)
+    message (FATAL_ERROR "startup_benchmark: timing `${scenario}' failed")
+  endif ()
+endforeach ()
+
+
+# End of `startup_benchmark.cmake'
@@ -0,0 +1,418 @@
+// ============================================================================
+//
+// File:        cli_benchmark.cxx
+// Description: Microbenchmarks of the `cli_template_app' hot path: option
+//              parsing, action execution and documentation rendering
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * cli_benchmark.cxx: created.
+// * cli_benchmark.cxx: added the trace point benchmarks.
+// * cli_benchmark.cxx: added the allocation-free parser benchmarks.
+// * cli_benchmark.cxx: added the action construction benchmarks.
+// * cli_benchmark.cxx: the strategy of an action is viewed instead of being
+//   copied into an arena.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "action_registry.hxx"
+#include "cli_actions.hxx"
+#include "cli_template_app.hxx"
+#include "hello_world_strategy.hxx"
+#include "help_text.hxx"  // Generated at build time
+#include "output_sinks.hxx"
+#include "tracing.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <benchmark/benchmark.h>  // Google Benchmark framework
+
+
+// ============================================================================
+// Benchmark Fixtures Section
+// ============================================================================
+
+namespace {
+
+    // Command line in the `argc'/`argv' form `main()' receives
+    class CommandLine {
+    public:
+        explicit CommandLine(std::vector<std::string> args)
+            : m_Args(std::move(args))
+        {
+            m_Args.insert(m_Args.begin(), std::string {kAppName});
+            for (auto& arg : m_Args) {
+                m_Argv.push_back(arg.data());
+            }
+            m_Argv.push_back(nullptr);
+        }
+
+        int argc() const {
+            return static_cast<int>(m_Args.size());
+        }
+
+        char** argv() {
+            return m_Argv.data();
+        }
+
+    private:
+        std::vector<std::string> m_Args;
+        std::vector<char*> m_Argv;
+    };
+
+    // Executes the action through the type erased `CliAction'
+    template <typename Strategy>
+    void executeDynamic(benchmark::State& state, Strategy strategy)
+    {
+        OutputSinks::MemorySink out;
+        OutputSinks::MemorySink err;
+        CliActions::CliAction action{kAppName, strategy, out, err};
+        for (auto _ : state) {
+            out.clear();
+            err.clear();
+            benchmark::DoNotOptimize(action.execute());
+        }
+        state.SetBytesProcessed(
+            state.iterations()
+            * static_cast<int64_t>(out.view().size() + err.view().size())
+        );
+    }
+
+    // Executes the action through the compile-time `StaticCliAction'
+    template <typename Strategy>
+    void executeStatic(benchmark::State& state, Strategy strategy)
+    {
+        OutputSinks::MemorySink out;
+        OutputSinks::MemorySink err;
+        CliActions::StaticCliAction<Strategy> action{
+            kAppName,
+            std::move(strategy),
+            out,
+            err
+        };
+        for (auto _ : state) {
+            out.clear();
+            err.clear();
+            benchmark::DoNotOptimize(action.execute());
+        }
+        state.SetBytesProcessed(
+            state.iterations()
+            * static_cast<int64_t>(out.view().size() + err.view().size())
+        );
+    }
+
+    char const* const kUnsupportedArgs[] = {"--foo", "bar"};
+    const ArgvParser::ArgSpan kUnsupported{kUnsupportedArgs, 2};
+
+};
+
+
+// ============================================================================
+// Benchmarks Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Parsing
+// ----------------------------------------------------------------------------
+//
+// Description: `clipp::parse' on `appOptions()' and the allocation-free
+//              `kOptionTable' for typical command lines, including the reset
+//              of the option values.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_ClippParse(
+    benchmark::State& state,
+    std::vector<std::string> args
+) {
+    CommandLine commandLine{std::move(args)};
+    clipp::group& options = appOptions();
+    for (auto _ : state) {
+        userOptionValues = kDefaultOptionValues;
+        auto result = clipp::parse(
+            commandLine.argc(),
+            commandLine.argv(),
+            options
+        );
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK_CAPTURE(BM_ClippParse, NoArguments, std::vector<std::string>{});
+BENCHMARK_CAPTURE(BM_ClippParse, Help, std::vector<std::string>{"--help"});
+BENCHMARK_CAPTURE(BM_ClippParse, Version, std::vector<std::string>{"-V"});
+BENCHMARK_CAPTURE(
+    BM_ClippParse,
+    Unsupported,
+    std::vector<std::string>{"--foo", "bar"}
+);
+
+static void BM_TableParse(
+    benchmark::State& state,
+    std::vector<std::string> args
+) {
+    CommandLine commandLine{std::move(args)};
+    // The parser reorders the argument vector, so parse a fresh copy
+    std::vector<char*> argv(
+        commandLine.argv(),
+        commandLine.argv() + commandLine.argc()
+    );
+    for (auto _ : state) {
+        std::copy(
+            commandLine.argv(),
+            commandLine.argv() + commandLine.argc(),
+            argv.begin()
+        );
+        CliOptionViews options{kDefaultOptionViews};
+        auto result = kOptionTable.parse(
+            commandLine.argc(),
+            argv.data(),
+            options
+        );
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(options);
+    }
+}
+BENCHMARK_CAPTURE(BM_TableParse, NoArguments, std::vector<std::string>{});
+BENCHMARK_CAPTURE(BM_TableParse, Help, std::vector<std::string>{"--help"});
+BENCHMARK_CAPTURE(BM_TableParse, Version, std::vector<std::string>{"-V"});
+BENCHMARK_CAPTURE(
+    BM_TableParse,
+    Unsupported,
+    std::vector<std::string>{"--foo", "bar"}
+);
+
+// ----------------------------------------------------------------------------
+// Execution
+// ----------------------------------------------------------------------------
+//
+// Description: Every strategy executed through `CliAction::execute' and
+//              through `StaticCliAction::execute', into memory sinks.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_ExecuteHelloWorld(benchmark::State& state)
+{
+    executeDynamic(state, HelloWorldStrategy{});
+}
+BENCHMARK(BM_ExecuteHelloWorld);
+
+static void BM_ExecuteHelloWorldStatic(benchmark::State& state)
+{
+    executeStatic(state, HelloWorldStrategy{});
+}
+BENCHMARK(BM_ExecuteHelloWorldStatic);
+
+static void BM_ExecuteShortHelp(benchmark::State& state)
+{
+    executeDynamic(state, CliActions::ShowShortHelpStrategy{});
+}
+BENCHMARK(BM_ExecuteShortHelp);
+
+static void BM_ExecuteShortHelpStatic(benchmark::State& state)
+{
+    executeStatic(state, CliActions::ShowShortHelpStrategy{});
+}
+BENCHMARK(BM_ExecuteShortHelpStatic);
+
+static void BM_ExecuteUnsupported(benchmark::State& state)
+{
+    executeDynamic(
+        state,
+        CliActions::UnsupportedOptionsStrategyClipp{kUnsupported}
+    );
+}
+BENCHMARK(BM_ExecuteUnsupported);
+
+static void BM_ExecuteUnsupportedStatic(benchmark::State& state)
+{
+    executeStatic(
+        state,
+        CliActions::UnsupportedOptionsStrategyClipp{kUnsupported}
+    );
+}
+BENCHMARK(BM_ExecuteUnsupportedStatic);
+
+static void BM_ExecuteMissingArgument(benchmark::State& state)
+{
+    executeDynamic(
+        state,
+        CliActions::MissingArgumentStrategyClipp{
+            "missing argument",
+            appOptions(),
+            CliActions::pageFormatting()
+        }
+    );
+}
+BENCHMARK(BM_ExecuteMissingArgument);
+
+static void BM_ExecuteMissingArgumentStatic(benchmark::State& state)
+{
+    executeStatic(
+        state,
+        CliActions::MissingArgumentStrategyClipp{
+            "missing argument",
+            appOptions(),
+            CliActions::pageFormatting()
+        }
+    );
+}
+BENCHMARK(BM_ExecuteMissingArgumentStatic);
+
+// ----------------------------------------------------------------------------
+// Construction
+// ----------------------------------------------------------------------------
+//
+// Description: Building a `CliAction' around a strategy too large for the
+//              inline storage of `std::function', copied to the heap and
+//              viewed by a callable stored inline.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_MakeActionHeap(benchmark::State& state)
+{
+    auto strategy = makeShowVersionStrategy();
+    for (auto _ : state) {
+        CliActions::CliAction action{kAppName, strategy};
+        benchmark::DoNotOptimize(&action);
+    }
+}
+BENCHMARK(BM_MakeActionHeap);
+
+static void BM_MakeActionViewed(benchmark::State& state)
+{
+    auto strategy = makeShowVersionStrategy();
+    for (auto _ : state) {
+        CliActions::CliAction action{
+            kAppName,
+            [&strategy](CliActions::CliAction const& action) {
+                return strategy(action);
+            }
+        };
+        benchmark::DoNotOptimize(&action);
+    }
+}
+BENCHMARK(BM_MakeActionViewed);
+
+// ----------------------------------------------------------------------------
+// Rendering
+// ----------------------------------------------------------------------------
+//
+// Description: Help, usage and version texts rendered by clipp at runtime
+//              next to the texts pre-rendered at build time.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_RenderHelpClipp(benchmark::State& state)
+{
+    executeDynamic(state, makeShowHelpStrategy());
+}
+BENCHMARK(BM_RenderHelpClipp);
+
+static void BM_RenderHelpPrerendered(benchmark::State& state)
+{
+    executeDynamic(
+        state,
+        CliActions::ShowStaticTextStrategy{PrerenderedText::kHelp}
+    );
+}
+BENCHMARK(BM_RenderHelpPrerendered);
+
+static void BM_RenderUsageClipp(benchmark::State& state)
+{
+    executeDynamic(state, makeShowUsageStrategy());
+}
+BENCHMARK(BM_RenderUsageClipp);
+
+static void BM_RenderUsagePrerendered(benchmark::State& state)
+{
+    executeDynamic(
+        state,
+        CliActions::ShowStaticTextStrategy{PrerenderedText::kUsage}
+    );
+}
+BENCHMARK(BM_RenderUsagePrerendered);
+
+static void BM_RenderVersion(benchmark::State& state)
+{
+    executeDynamic(state, makeShowVersionStrategy());
+}
+BENCHMARK(BM_RenderVersion);
+
+static void BM_RenderVersionPrerendered(benchmark::State& state)
+{
+    executeDynamic(
+        state,
+        CliActions::ShowStaticTextStrategy{PrerenderedText::kVersion}
+    );
+}
+BENCHMARK(BM_RenderVersionPrerendered);
+
+// ----------------------------------------------------------------------------
+// Tracing
+// ----------------------------------------------------------------------------
+//
+// Description: Cost of a trace point with the tracing disabled (the default)
+//              and enabled.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_TraceScopeDisabled(benchmark::State& state)
+{
+    Tracing::setEnabled(false);
+    for (auto _ : state) {
+        TRACE_SCOPE("disabled");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TraceScopeDisabled);
+
+static void BM_TraceScopeEnabled(benchmark::State& state)
+{
+    Tracing::setEnabled(true);
+    for (auto _ : state) {
+        TRACE_SCOPE("enabled");
+        benchmark::ClobberMemory();
+    }
+    Tracing::setEnabled(false);
+    Tracing::reset();
+}
+BENCHMARK(BM_TraceScopeEnabled);
+
+
+// End of `cli_benchmark.cxx'
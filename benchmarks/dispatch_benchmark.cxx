@@ -0,0 +1,183 @@
+// ============================================================================
+//
+// File:        dispatch_benchmark.cxx
+// Description: Compares the cost of executing an action through the type
+//              erased `CliAction' and through the compile-time
+//              `StaticCliAction'
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * dispatch_benchmark.cxx: created.
+// * dispatch_benchmark.cxx: the benchmarked action set has as many
+//   alternatives as `ProgramAction' of `cli_template_app'.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "action_registry.hxx"
+#include "cli_actions.hxx"
+
+// Standard library headers
+#include <memory>
+#include <string>
+
+// External libraries headers
+#include <benchmark/benchmark.h>  // Google Benchmark framework
+
+
+// ============================================================================
+// Benchmark Fixtures Section
+// ============================================================================
+
+namespace {
+
+    // Longer than the small string buffer, like the real exec name
+    const std::string kExecName{"cli_template_app"};
+
+    // Strategies doing no work, so only the dispatch itself is measured. They
+    // differ in the returned value only, to keep them from being folded.
+    template <int Status>
+    class ReturnStrategy : public CliActions::BaseStrategy {
+    public:
+        int operator()(CliActions::ActionContext const& action) const override {
+            benchmark::DoNotOptimize(action.execName().data());
+            return Status;
+        }
+    };
+
+    using FirstStrategy = ReturnStrategy<0>;
+    using MiddleStrategy = ReturnStrategy<5>;
+    using LastStrategy = ReturnStrategy<10>;
+
+    // Same number of alternatives as `ProgramAction', the action set of
+    // `cli_template_app' (11 strategies)
+    using Action = CliActions::StaticCliAction<
+        FirstStrategy,
+        ReturnStrategy<1>,
+        ReturnStrategy<2>,
+        ReturnStrategy<3>,
+        ReturnStrategy<4>,
+        MiddleStrategy,
+        ReturnStrategy<6>,
+        ReturnStrategy<7>,
+        ReturnStrategy<8>,
+        ReturnStrategy<9>,
+        LastStrategy
+    >;
+
+};
+
+
+// ============================================================================
+// Benchmarks Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Execute only
+// ----------------------------------------------------------------------------
+//
+// Description: Cost of `execute()' on an already constructed action.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_CliActionExecute(benchmark::State& state)
+{
+    CliActions::CliAction action{kExecName, MiddleStrategy{}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(action.execute());
+    }
+}
+BENCHMARK(BM_CliActionExecute);
+
+static void BM_StaticCliActionExecute(benchmark::State& state)
+{
+    Action action{kExecName, MiddleStrategy{}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(action.execute());
+    }
+}
+BENCHMARK(BM_StaticCliActionExecute);
+
+static void BM_StaticCliActionExecuteLast(benchmark::State& state)
+{
+    Action action{kExecName, LastStrategy{}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(action.execute());
+    }
+}
+BENCHMARK(BM_StaticCliActionExecuteLast);
+
+static void BM_ExecuteStatic(benchmark::State& state)
+{
+    MiddleStrategy strategy;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            CliActions::executeStatic(kExecName, strategy)
+        );
+    }
+}
+BENCHMARK(BM_ExecuteStatic);
+
+// ----------------------------------------------------------------------------
+// Select and execute
+// ----------------------------------------------------------------------------
+//
+// Description: Cost of building the action the way `main()' does it and
+//              executing it once.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_CliActionSelectAndExecute(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto action = std::make_unique<CliActions::CliAction>(
+            kExecName,
+            MiddleStrategy{}
+        );
+        benchmark::DoNotOptimize(action->execute());
+    }
+}
+BENCHMARK(BM_CliActionSelectAndExecute);
+
+static void BM_StaticCliActionSelectAndExecute(benchmark::State& state)
+{
+    for (auto _ : state) {
+        Action action{kExecName, MiddleStrategy{}};
+        benchmark::DoNotOptimize(action.execute());
+    }
+}
+BENCHMARK(BM_StaticCliActionSelectAndExecute);
+
+
+// End of `dispatch_benchmark.cxx'
@@ -0,0 +1,207 @@
+// ============================================================================
+//
+// File:        input_benchmark.cxx
+// Description: Throughput of the streaming input backends, in GB/s, over a
+//              large file of lines
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * input_benchmark.cxx: created.
+// * input_benchmark.cxx: lines are counted by the text kernels.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "input_streams.hxx"
+#include "text_kernels.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+// External libraries headers
+#include <benchmark/benchmark.h>  // Google Benchmark framework
+
+
+// ============================================================================
+// Benchmark Fixtures Section
+// ============================================================================
+
+namespace {
+
+    // Size of the input file, override with INPUT_BENCHMARK_MB
+    constexpr std::size_t kDefaultInputMegabytes{256};
+
+    // Log-like file of lines written once per run of the benchmark, and
+    // removed at exit. Runs after the first one read it from the page
+    // cache, so the results are the throughput of the backends themselves
+    // rather than the one of the storage.
+    class InputFile {
+    public:
+        InputFile() {
+            std::size_t megabytes = kDefaultInputMegabytes;
+            if (char const* value = std::getenv("INPUT_BENCHMARK_MB")) {
+                megabytes = std::max<std::size_t>(
+                    1,
+                    std::strtoul(value, nullptr, 10)
+                );
+            }
+
+            m_Path = std::filesystem::temp_directory_path()
+                / "input_benchmark.log";
+            std::ofstream file{m_Path, std::ios::binary};
+            std::string block;
+            for (int line = 0; block.size() < 1024 * 1024; ++line) {
+                block += "2026-10-17T12:00:00.000 INFO worker-"
+                    + std::to_string(line % 64)
+                    + " processed request " + std::to_string(line)
+                    + " in " + std::to_string(line % 997) + " us\n";
+            }
+            for (std::size_t i = 0; i < megabytes; ++i) {
+                file.write(
+                    block.data(),
+                    static_cast<std::streamsize>(block.size())
+                );
+            }
+            m_Size = megabytes * block.size();
+        }
+
+        ~InputFile() {
+            std::error_code ignored;
+            std::filesystem::remove(m_Path, ignored);
+        }
+
+        std::string path() const {
+            return m_Path.string();
+        }
+
+        std::size_t size() const {
+            return m_Size;
+        }
+
+    private:
+        std::filesystem::path m_Path;
+        std::size_t m_Size{0};
+    };
+
+    InputFile const& inputFile() {
+        static InputFile const file;
+        return file;
+    }
+
+    // Streams the whole file as runs of lines and counts the lines, the
+    // lightest processing a line strategy does (as `--count')
+    void streamFile(
+        benchmark::State& state,
+        InputStreams::Backend backend
+    ) {
+        if (!InputStreams::backendAvailable(backend)) {
+            state.SkipWithError("backend not available");
+            return;
+        }
+        auto const& file = inputFile();
+        std::size_t const chunkSize = static_cast<std::size_t>(state.range(0));
+        std::uint64_t lines = 0;
+
+        for (auto _ : state) {
+            InputStreams::InputFile input{file.path().c_str()};
+            auto source = InputStreams::openChunkSource(
+                input.fd(),
+                backend,
+                chunkSize
+            );
+            InputStreams::RecordReader reader{*source};
+            std::string_view records;
+            while (reader.next(records)) {
+                lines += TextKernels::countByte(records, '\n');
+            }
+        }
+        benchmark::DoNotOptimize(lines);
+
+        auto const bytes = static_cast<double>(state.iterations())
+            * static_cast<double>(file.size());
+        state.SetBytesProcessed(static_cast<int64_t>(bytes));
+        state.counters["GB/s"] = benchmark::Counter(
+            bytes / 1e9,
+            benchmark::Counter::kIsRate
+        );
+    }
+
+};
+
+
+// ============================================================================
+// Benchmarks Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Backends
+// ----------------------------------------------------------------------------
+//
+// Description: The whole input file read through each backend, with chunks
+//              of 64 KiB, 1 MiB (the default) and 8 MiB.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_StreamMmap(benchmark::State& state)
+{
+    streamFile(state, InputStreams::Backend::Mmap);
+}
+BENCHMARK(BM_StreamMmap)
+    ->Arg(64 << 10)->Arg(1 << 20)->Arg(8 << 20)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_StreamRead(benchmark::State& state)
+{
+    streamFile(state, InputStreams::Backend::Read);
+}
+BENCHMARK(BM_StreamRead)
+    ->Arg(64 << 10)->Arg(1 << 20)->Arg(8 << 20)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_StreamIoUring(benchmark::State& state)
+{
+    streamFile(state, InputStreams::Backend::IoUring);
+}
+BENCHMARK(BM_StreamIoUring)
+    ->Arg(64 << 10)->Arg(1 << 20)->Arg(8 << 20)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+// End of `input_benchmark.cxx'
@@ -0,0 +1,301 @@
+// ============================================================================
+//
+// File:        startup_benchmark.cxx
+// Description: End-to-end harness spawning `cli_template_app' builds many
+//              times and reporting their startup latency percentiles
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * startup_benchmark.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// System headers
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+
+// ============================================================================
+// Global Constants Section
+// ============================================================================
+
+static constexpr int kDefaultRuns = 200;
+static constexpr int kWarmUpRuns = 10;
+
+
+// ============================================================================
+// Utility Types Section
+// ============================================================================
+
+// Executable under test, given on the command line as `LABEL=PATH'
+struct Subject {
+    std::string label;
+    std::string path;
+};
+
+// Wall-clock time from `posix_spawn' to `waitpid' returning, in microseconds
+struct Summary {
+    std::string label;
+    int runs;
+    int failures;
+    double min;
+    double p50;
+    double p99;
+    double max;
+    double mean;
+};
+
+
+// ============================================================================
+// Measurement Section
+// ============================================================================
+
+// Spawns the executable once with its output discarded, returns the elapsed
+// time in microseconds, or a negative value if it did not exit cleanly
+static double spawnOnce(
+    std::string const& path,
+    std::vector<std::string> const& args
+) {
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>(path.c_str()));
+    for (auto const& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(
+        &actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(
+        &actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+
+    pid_t pid = 0;
+    auto start = std::chrono::steady_clock::now();
+    int result = posix_spawn(
+        &pid, path.c_str(), &actions, nullptr, argv.data(), environ);
+    int status = 0;
+    if (0 == result) {
+        while (waitpid(pid, &status, 0) < 0 && EINTR == errno) { }
+    }
+    auto stop = std::chrono::steady_clock::now();
+    posix_spawn_file_actions_destroy(&actions);
+
+    if (0 != result || !WIFEXITED(status)) {
+        return -1.0;
+    }
+
+    return std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+// Nearest-rank percentile of sorted samples
+static double percentile(std::vector<double> const& sorted, double p)
+{
+    auto rank = static_cast<std::size_t>(
+        std::ceil(p / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::max<std::size_t>(rank, 1) - 1];
+}
+
+static Summary measure(
+    Subject const& subject,
+    std::vector<std::string> const& args,
+    int runs
+) {
+    for (int i = 0; i < kWarmUpRuns; ++i) {
+        spawnOnce(subject.path, args);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(runs);
+    int failures = 0;
+    for (int i = 0; i < runs; ++i) {
+        double elapsed = spawnOnce(subject.path, args);
+        if (elapsed < 0.0) {
+            ++failures;
+        } else {
+            samples.push_back(elapsed);
+        }
+    }
+
+    Summary summary{subject.label, runs, failures, 0, 0, 0, 0, 0};
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    summary.min = samples.front();
+    summary.p50 = percentile(samples, 50.0);
+    summary.p99 = percentile(samples, 99.0);
+    summary.max = samples.back();
+    for (double sample : samples) {
+        summary.mean += sample;
+    }
+    summary.mean /= static_cast<double>(samples.size());
+
+    return summary;
+}
+
+
+// ============================================================================
+// Reporting Section
+// ============================================================================
+
+static void printTable(std::vector<Summary> const& summaries)
+{
+    std::cout << std::left << std::setw(16) << "build"
+        << std::right << std::setw(8) << "runs"
+        << std::setw(11) << "min [us]"
+        << std::setw(11) << "p50 [us]"
+        << std::setw(11) << "p99 [us]"
+        << std::setw(11) << "max [us]"
+        << std::setw(11) << "mean [us]" << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    for (auto const& s : summaries) {
+        std::cout << std::left << std::setw(16) << s.label
+            << std::right << std::setw(8) << s.runs - s.failures
+            << std::setw(11) << s.min
+            << std::setw(11) << s.p50
+            << std::setw(11) << s.p99
+            << std::setw(11) << s.max
+            << std::setw(11) << s.mean << "\n";
+    }
+}
+
+static void writeJson(
+    std::ostream& os,
+    std::vector<Summary> const& summaries,
+    std::vector<std::string> const& args
+) {
+    os << "{\n  \"arguments\": [";
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        os << (i ? ", " : "") << "\"" << args[i] << "\"";
+    }
+    os << "],\n  \"unit\": \"us\",\n  \"results\": [\n";
+    os << std::fixed << std::setprecision(3);
+    for (std::size_t i = 0; i < summaries.size(); ++i) {
+        auto const& s = summaries[i];
+        os << "    {\"build\": \"" << s.label << "\""
+            << ", \"runs\": " << s.runs
+            << ", \"failures\": " << s.failures
+            << ", \"min\": " << s.min
+            << ", \"p50\": " << s.p50
+            << ", \"p99\": " << s.p99
+            << ", \"max\": " << s.max
+            << ", \"mean\": " << s.mean << "}"
+            << (i + 1 < summaries.size() ? ",\n" : "\n");
+    }
+    os << "  ]\n}\n";
+}
+
+
+// ============================================================================
+// Main Function Section
+// ============================================================================
+
+static void printUsage()
+{
+    std::cerr << "Usage: startup_benchmark [--runs N] [--json FILE]"
+        " LABEL=PATH... [-- ARGS...]\n";
+}
+
+int main(int argc, char** argv)
+{
+    int runs = kDefaultRuns;
+    std::string jsonPath;
+    std::vector<Subject> subjects;
+    std::vector<std::string> args;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ("--runs" == arg && i + 1 < argc) {
+            runs = std::atoi(argv[++i]);
+        } else if ("--json" == arg && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if ("--" == arg) {
+            args.assign(argv + i + 1, argv + argc);
+            break;
+        } else if (auto eq = arg.find('='); std::string::npos != eq) {
+            subjects.push_back({arg.substr(0, eq), arg.substr(eq + 1)});
+        } else {
+            printUsage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (subjects.empty() || runs <= 0) {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Summary> summaries;
+    bool failed = false;
+    for (auto const& subject : subjects) {
+        summaries.push_back(measure(subject, args, runs));
+        if (summaries.back().failures == runs) {
+            std::cerr << "startup_benchmark: cannot run " << subject.path
+                << "\n";
+            failed = true;
+        }
+    }
+
+    printTable(summaries);
+    if (!jsonPath.empty()) {
+        std::ofstream file(jsonPath, std::ios::trunc);
+        writeJson(file, summaries, args);
+        if (!file) {
+            std::cerr << "startup_benchmark: cannot write " << jsonPath
+                << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// End of `startup_benchmark.cxx'
@@ -0,0 +1,191 @@
+// ============================================================================
+//
+// File:        text_kernels_benchmark.cxx
+// Description: Throughput of each variant of the text kernels, in GB/s, over
+//              buffers of lines sized for the levels of the cache
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * text_kernels_benchmark.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "text_kernels.hxx"
+
+// Standard library headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// External libraries headers
+#include <benchmark/benchmark.h>  // Google Benchmark framework
+
+
+// ============================================================================
+// Benchmark Fixtures Section
+// ============================================================================
+
+namespace {
+
+    // Log-like lines, a few of them with non-ASCII text, repeated to the
+    // size of the buffer
+    std::string const& text(std::size_t size) {
+        static std::string text;
+        if (text.size() < size) {
+            text.clear();
+            for (int line = 0; text.size() < size; ++line) {
+                text += "2026-10-17T12:00:00.000 INFO worker-"
+                    + std::to_string(line % 64)
+                    + (0 == line % 16 ? " r\xC3\xA9sum\xC3\xA9" : "")
+                    + " processed request " + std::to_string(line)
+                    + " in " + std::to_string(line % 997) + " us\n";
+            }
+        }
+        return text;
+    }
+
+    // Runs the kernel over buffers of `state.range(0)' bytes with the
+    // variant of the ISA, skipped where the variant is not supported
+    template <typename Kernel>
+    void runKernel(
+        benchmark::State& state,
+        TextKernels::Isa isa,
+        Kernel kernel
+    ) {
+        TextKernels::Kernels const* kernels = TextKernels::variant(isa);
+        if (nullptr == kernels) {
+            state.SkipWithError("variant not supported");
+            return;
+        }
+        std::size_t const size = static_cast<std::size_t>(state.range(0));
+        std::string const input = text(size).substr(0, size);
+        std::vector<char> output(size);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(
+                kernel(*kernels, input.data(), size, output.data())
+            );
+            benchmark::ClobberMemory();
+        }
+
+        auto const bytes = static_cast<double>(state.iterations())
+            * static_cast<double>(size);
+        state.SetBytesProcessed(static_cast<int64_t>(bytes));
+        state.counters["GB/s"] = benchmark::Counter(
+            bytes / 1e9,
+            benchmark::Counter::kIsRate
+        );
+    }
+
+};
+
+
+// ============================================================================
+// Benchmarks Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Kernels
+// ----------------------------------------------------------------------------
+//
+// Description: Each kernel with each variant, over 16 KiB (L1 cache),
+//              256 KiB (L2 cache) and 8 MiB (memory) buffers. Byte search
+//              looks for a byte the text does not hold, so it scans the
+//              whole buffer.
+//
+// ----------------------------------------------------------------------------
+
+// The kernel with every variant, scalar first
+#define TEXT_KERNEL_BENCHMARKS(Function)                                       \
+    BENCHMARK_CAPTURE(Function, scalar, TextKernels::Isa::Scalar)              \
+        ->Arg(16 << 10)->Arg(256 << 10)->Arg(8 << 20);                         \
+    BENCHMARK_CAPTURE(Function, sse2, TextKernels::Isa::Sse2)                  \
+        ->Arg(16 << 10)->Arg(256 << 10)->Arg(8 << 20);                         \
+    BENCHMARK_CAPTURE(Function, avx2, TextKernels::Isa::Avx2)                  \
+        ->Arg(16 << 10)->Arg(256 << 10)->Arg(8 << 20);                         \
+    BENCHMARK_CAPTURE(Function, avx512, TextKernels::Isa::Avx512)              \
+        ->Arg(16 << 10)->Arg(256 << 10)->Arg(8 << 20)
+
+static void BM_FindByte(benchmark::State& state, TextKernels::Isa isa)
+{
+    runKernel(
+        state,
+        isa,
+        [](auto const& kernels, char const* data, std::size_t size, char*) {
+            return kernels.findByte(data, size, '\x01');
+        }
+    );
+}
+TEXT_KERNEL_BENCHMARKS(BM_FindByte);
+
+static void BM_CountByte(benchmark::State& state, TextKernels::Isa isa)
+{
+    runKernel(
+        state,
+        isa,
+        [](auto const& kernels, char const* data, std::size_t size, char*) {
+            return kernels.countByte(data, size, '\n');
+        }
+    );
+}
+TEXT_KERNEL_BENCHMARKS(BM_CountByte);
+
+static void BM_FoldCase(benchmark::State& state, TextKernels::Isa isa)
+{
+    runKernel(
+        state,
+        isa,
+        [](auto const& kernels, char const* data, std::size_t size, char* out) {
+            kernels.foldCase(data, size, out);
+            return out[0];
+        }
+    );
+}
+TEXT_KERNEL_BENCHMARKS(BM_FoldCase);
+
+static void BM_ValidUtf8(benchmark::State& state, TextKernels::Isa isa)
+{
+    runKernel(
+        state,
+        isa,
+        [](auto const& kernels, char const* data, std::size_t size, char*) {
+            return kernels.validUtf8(data, size);
+        }
+    );
+}
+TEXT_KERNEL_BENCHMARKS(BM_ValidUtf8);
+
+
+// End of `text_kernels_benchmark.cxx'
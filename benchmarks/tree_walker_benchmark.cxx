@@ -0,0 +1,233 @@
+// ============================================================================
+//
+// File:        tree_walker_benchmark.cxx
+// Description: Scaling of the parallel directory walk with the number of
+//              worker threads, over a generated directory tree
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * tree_walker_benchmark.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "argv_parser.hxx"
+#include "tree_walker.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+
+// External libraries headers
+#include <benchmark/benchmark.h>  // Google Benchmark framework
+
+
+// ============================================================================
+// Benchmark Fixtures Section
+// ============================================================================
+
+namespace {
+
+    // Number of files of the tree, override with TREE_BENCHMARK_FILES
+    constexpr std::size_t kDefaultFiles{50000};
+
+    // Shape of the tree: files and subdirectories of every directory
+    constexpr std::size_t kFilesPerDirectory{16};
+    constexpr std::size_t kSubdirectories{8};
+
+    // Directory tree generated once per run of the benchmark, breadth first
+    // (`kSubdirectories' per directory until the files run out), and
+    // removed at exit. Runs after the first one read the directories from
+    // the dentry and inode caches, so the results are the scaling of the
+    // walk itself rather than the one of the storage.
+    class SyntheticTree {
+    public:
+        SyntheticTree() {
+            std::size_t files = kDefaultFiles;
+            if (char const* value = std::getenv("TREE_BENCHMARK_FILES")) {
+                files = std::max<std::size_t>(
+                    1,
+                    std::strtoul(value, nullptr, 10)
+                );
+            }
+
+            m_Root = std::filesystem::temp_directory_path()
+                / "tree_walker_benchmark";
+            std::filesystem::remove_all(m_Root);
+
+            std::deque<std::filesystem::path> directories{m_Root};
+            while (m_Files < files) {
+                auto const directory = directories.front();
+                directories.pop_front();
+                std::filesystem::create_directory(directory);
+                ++m_Directories;
+                for (std::size_t i = 0;
+                    i < kFilesPerDirectory && m_Files < files;
+                    ++i, ++m_Files
+                ) {
+                    auto const path = directory / ("file" + std::to_string(i));
+                    std::ofstream{path};
+                    // Sparse, nothing is written
+                    std::filesystem::resize_file(path, (m_Files % 97) * 100);
+                }
+                for (std::size_t i = 0; i < kSubdirectories; ++i) {
+                    directories.push_back(
+                        directory / ("dir" + std::to_string(i))
+                    );
+                }
+            }
+            m_RootName = m_Root.string();
+            m_Roots[0] = m_RootName.c_str();
+        }
+
+        ~SyntheticTree() {
+            std::error_code ignored;
+            std::filesystem::remove_all(m_Root, ignored);
+        }
+
+        ArgvParser::ArgSpan roots() const {
+            return ArgvParser::ArgSpan{m_Roots, 1};
+        }
+
+        std::size_t files() const {
+            return m_Files;
+        }
+
+        std::size_t directories() const {
+            return m_Directories;
+        }
+
+    private:
+        std::filesystem::path m_Root;
+        std::string m_RootName;
+        char const* m_Roots[1]{nullptr};
+        std::size_t m_Files{0};
+        std::size_t m_Directories{0};
+    };
+
+    SyntheticTree const& syntheticTree() {
+        static SyntheticTree const tree;
+        return tree;
+    }
+
+    // Adds up the sizes of the files, one status call per file (as `du')
+    class SizeVisitor : public TreeWalker::FileVisitor {
+    public:
+        std::unique_ptr<TreeWalker::FileVisitor> fork() const override {
+            return std::make_unique<SizeVisitor>();
+        }
+
+        void visit(std::filesystem::directory_entry const& entry) override {
+            std::error_code error;
+            auto const size = entry.file_size(error);
+            if (!error) {
+                m_Bytes += size;
+            }
+        }
+
+        void merge(TreeWalker::FileVisitor& fork) override {
+            m_Bytes += static_cast<SizeVisitor&>(fork).m_Bytes;
+        }
+
+        std::uintmax_t bytes() const {
+            return m_Bytes;
+        }
+
+    private:
+        std::uintmax_t m_Bytes{0};
+    };
+
+    // 1, 2, 4, ... worker threads up to the number of CPUs
+    void jobCounts(benchmark::internal::Benchmark* benchmark) {
+        unsigned const cpus = TreeWalker::defaultJobs();
+        for (unsigned jobs = 1; jobs < cpus; jobs *= 2) {
+            benchmark->Arg(jobs);
+        }
+        benchmark->Arg(cpus);
+    }
+
+};
+
+
+// ============================================================================
+// Benchmarks Section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Walk
+// ----------------------------------------------------------------------------
+//
+// Description: The whole synthetic tree walked on 1, 2, 4, ... threads up to
+//              the number of CPUs, with the size of every file looked up.
+//
+// ----------------------------------------------------------------------------
+
+static void BM_Walk(benchmark::State& state)
+{
+    auto const& tree = syntheticTree();
+    unsigned const jobs = static_cast<unsigned>(state.range(0));
+
+    for (auto _ : state) {
+        SizeVisitor visitor;
+        auto const stats = TreeWalker::walk(tree.roots(), visitor, jobs);
+        if (stats.files != tree.files()
+            || stats.directories != tree.directories()
+        ) {
+            state.SkipWithError("walk missed entries of the tree");
+            return;
+        }
+        benchmark::DoNotOptimize(visitor.bytes());
+    }
+
+    auto const files = static_cast<double>(state.iterations())
+        * static_cast<double>(tree.files());
+    state.counters["files/s"] = benchmark::Counter(
+        files,
+        benchmark::Counter::kIsRate
+    );
+}
+BENCHMARK(BM_Walk)
+    ->Apply(jobCounts)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+// End of `tree_walker_benchmark.cxx'
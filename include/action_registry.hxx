@@ -0,0 +1,175 @@
+// ============================================================================
+//
+// File:        action_registry.hxx
+// Description: Compile-time action registry. Dispatches to one of a fixed set
+//              of strategies without type erasure, heap allocation or virtual
+//              calls
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * action_registry.hxx: created.
+// * action_registry.hxx: actions take the output sinks for the strategies.
+// * action_registry.hxx: `StaticCliAction::execute()' is a trace point.
+// * action_registry.hxx: actions take the memory arena for the strategies.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "cli_actions.hxx"
+#include "tracing.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// ============================================================================
+// Static Action Section
+// ============================================================================
+
+namespace CliActions {
+
+	// ------------------------------------------------------------------------
+	// StaticCliAction
+	// ------------------------------------------------------------------------
+	//
+	// Description: Command-line action holding one strategy out of a closed
+	//              set of strategy types listed as template arguments.
+	//
+	//              The strategy is stored by value in a `std::variant', so
+	//              selecting an action does not allocate. `execute()' expands
+	//              into a chain of index comparisons, each followed by a
+	//              qualified (hence non-virtual) call of the strategy's call
+	//              operator, so there is no indirect call either. With a single
+	//              strategy type the dispatch folds away completely.
+	//
+	//              Any class derived from `BaseStrategy' (e.g. the ones in
+	//              hello_world_strategy.hxx) can be listed, as well as any
+	//              other type with `int operator()(ActionContext const&) const'.
+	//
+	// ------------------------------------------------------------------------
+	template <typename... Strategies>
+	class StaticCliAction : public ActionContext {
+		static_assert(sizeof...(Strategies) > 0, "No strategies given");
+
+	public:
+		using StrategyVariant = std::variant<Strategies...>;
+
+		template <
+			typename Strategy,
+			typename = std::enable_if_t<
+				(std::is_same_v<std::decay_t<Strategy>, Strategies> || ...)
+			>
+		>
+		explicit StaticCliAction(
+			std::string_view const& exec_name,
+			Strategy&& strategy,
+			OutputSinks::OutputSink& out = OutputSinks::standardOutput(),
+			OutputSinks::OutputSink& err = OutputSinks::standardError(),
+			std::pmr::memory_resource& arena = *std::pmr::get_default_resource()
+		) : ActionContext{exec_name, out, err, arena},
+			m_Strategy{
+				std::in_place_type<std::decay_t<Strategy>>,
+				std::forward<Strategy>(strategy)
+			}
+		{ }
+
+		int execute() const {
+			TRACE_SCOPE("StaticCliAction::execute");
+			return dispatch(std::index_sequence_for<Strategies...>{});
+		}
+
+		// Index of the selected strategy in the `Strategies' list
+		std::size_t index() const {
+			return m_Strategy.index();
+		}
+
+	private:
+		template <std::size_t... Index>
+		int dispatch(std::index_sequence<Index...>) const {
+			int status = EXIT_FAILURE;
+			std::size_t const selected = m_Strategy.index();
+
+			// Short-circuits on the first matching index
+			static_cast<void>((
+				(selected == Index
+					&& (status = invoke(*std::get_if<Index>(&m_Strategy)), true))
+				|| ...
+			));
+
+			return status;
+		}
+
+		template <typename Strategy>
+		int invoke(Strategy const& strategy) const {
+			// Qualified name binds the call statically even if the call
+			// operator is virtual
+			return strategy.Strategy::operator()(
+				static_cast<ActionContext const&>(*this)
+			);
+		}
+
+		StrategyVariant m_Strategy;
+	};
+
+	// ------------------------------------------------------------------------
+	// executeStatic
+	// ------------------------------------------------------------------------
+	//
+	// Description: Executes a strategy chosen at compile time. Equivalent to
+	//              `StaticCliAction<Strategy>{exec_name, strategy}.execute()'
+	//              without copying the strategy.
+	//
+	// ------------------------------------------------------------------------
+	template <typename Strategy>
+	int executeStatic(
+		std::string_view const& exec_name,
+		Strategy const& strategy,
+		OutputSinks::OutputSink& out = OutputSinks::standardOutput(),
+		OutputSinks::OutputSink& err = OutputSinks::standardError(),
+		std::pmr::memory_resource& arena = *std::pmr::get_default_resource()
+	) {
+		return strategy.Strategy::operator()(
+			ActionContext{exec_name, out, err, arena}
+		);
+	}
+
+};
+
+// End of `action_registry.hxx'
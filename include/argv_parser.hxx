@@ -0,0 +1,372 @@
+// ============================================================================
+//
+// File:        argv_parser.hxx
+// Description: Allocation-free command line parser. Options are described by
+//              a constexpr table with a perfect hash, parsed values are views
+//              into the argument vector
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * argv_parser.hxx: created.
+// * argv_parser.hxx: added positional arguments.
+// * argv_parser.hxx: an empty argument is not taken as an option value.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+// ============================================================================
+// Argument Vector Parser Section
+// ============================================================================
+
+namespace ArgvParser {
+	// Seeds tried while looking for a perfect hash of the option names
+	constexpr std::uint32_t MAX_HASH_SEED{1u << 16};
+
+	// ------------------------------------------------------------------------
+	// ArgSpan
+	// ------------------------------------------------------------------------
+	//
+	// Description: Non-owning view of a run of arguments of an argument
+	//              vector.
+	//
+	// ------------------------------------------------------------------------
+	class ArgSpan {
+	public:
+		constexpr ArgSpan() = default;
+		constexpr ArgSpan(char const* const* first, std::size_t size)
+			: m_First{first}, m_Size{size}
+		{ }
+
+		constexpr char const* const* begin() const {
+			return m_First;
+		}
+
+		constexpr char const* const* end() const {
+			return m_First + m_Size;
+		}
+
+		constexpr std::size_t size() const {
+			return m_Size;
+		}
+
+		constexpr bool empty() const {
+			return 0 == m_Size;
+		}
+
+		constexpr std::string_view operator[](std::size_t index) const {
+			return m_First[index];
+		}
+
+	private:
+		char const* const* m_First{nullptr};
+		std::size_t m_Size{0};
+	};
+
+	enum class OptionKind { Flag, Value };
+
+	// ------------------------------------------------------------------------
+	// Option
+	// ------------------------------------------------------------------------
+	//
+	// Description: One name of an option and the member of the `Values'
+	//              structure it sets. A flag sets a `bool' member, a value
+	//              option stores the argument following it into a
+	//              `std::string_view' member. Options with a short and a long
+	//              name are listed once for each name.
+	//
+	// ------------------------------------------------------------------------
+	template <typename Values>
+	struct Option {
+		std::string_view name;
+		OptionKind kind;
+		bool Values::* flag;
+		std::string_view Values::* value;
+	};
+
+	template <typename Values>
+	constexpr Option<Values> flag(
+		std::string_view name,
+		bool Values::* target
+	) {
+		return Option<Values>{name, OptionKind::Flag, target, nullptr};
+	}
+
+	template <typename Values>
+	constexpr Option<Values> value(
+		std::string_view name,
+		std::string_view Values::* target
+	) {
+		return Option<Values>{name, OptionKind::Value, nullptr, target};
+	}
+
+	// FNV-1a hash of the name, salted with the seed
+	constexpr std::uint32_t hashName(
+		std::string_view name,
+		std::uint32_t seed
+	) {
+		std::uint32_t hash = 2166136261u ^ seed;
+		for (char c : name) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	// Member of the `Values' structure receiving the positional arguments
+	// (the ones not starting with a dash), see `makeOptionTable'
+	template <typename Values>
+	struct Positionals {
+		ArgSpan Values::* target;
+	};
+
+	template <typename Values>
+	constexpr Positionals<Values> positionals(ArgSpan Values::* target) {
+		return Positionals<Values>{target};
+	}
+
+	// Outcome of a parse. Unsupported arguments are reported through the
+	// `Values' structure.
+	struct ParseResult {
+		// Value option given as the last argument, if any
+		std::string_view missing_value;
+
+		explicit operator bool() const {
+			return missing_value.empty();
+		}
+	};
+
+	// ------------------------------------------------------------------------
+	// OptionTable
+	// ------------------------------------------------------------------------
+	//
+	// Description: Closed set of options, built at compile time (see
+	//              `makeOptionTable'). The constructor searches for a hash seed
+	//              that maps every option name to its own slot, so a lookup is
+	//              one hash of the argument and one string comparison.
+	//
+	//              `parse' mirrors how clipp treats a group of flags, option &
+	//              value pairs and `any_other': a value option takes the next
+	//              argument whatever it looks like unless it is empty (clipp
+	//              values must not be empty, so the option is left without
+	//              one), and every argument that is not an option name is
+	//              unsupported. Repeated flags are
+	//              accepted. Nothing is allocated: values are views into the
+	//              argument strings, and the unsupported arguments are moved to
+	//              the front of `argv' (right after the program name) and
+	//              reported as a span of it. With positional arguments enabled
+	//              the arguments not starting with a dash are moved in front of
+	//              the unsupported ones and reported as a span of their own,
+	//              the same way clipp fills `values' filtered with
+	//              `match::prefix_not("-")'.
+	//
+	// ------------------------------------------------------------------------
+	template <typename Values, std::size_t Count>
+	class OptionTable {
+		static_assert(Count > 0, "No options given");
+		static_assert(Count < 255, "Too many options");
+
+	public:
+		// Power of two with at least four slots per option keeps the seed
+		// search short
+		static constexpr std::size_t kSlots = [] {
+			std::size_t slots = 1;
+			while (slots < 4 * Count) {
+				slots *= 2;
+			}
+			return slots;
+		}();
+
+		constexpr OptionTable(
+			ArgSpan Values::* unsupported,
+			ArgSpan Values::* positionals,
+			std::array<Option<Values>, Count> const& options
+		) : m_Unsupported{unsupported},
+			m_Positionals{positionals},
+			m_Options{options}
+		{
+			for (std::size_t i = 0; i < Count; ++i) {
+				for (std::size_t j = i + 1; j < Count; ++j) {
+					if (m_Options[i].name == m_Options[j].name) {
+						throw std::logic_error("Duplicate option name");
+					}
+				}
+				if (m_Options[i].name.size() > m_MaxNameSize) {
+					m_MaxNameSize = m_Options[i].name.size();
+				}
+			}
+
+			for (std::uint32_t seed = 0; seed < MAX_HASH_SEED; ++seed) {
+				if (tryPlace(seed)) {
+					m_Seed = seed;
+					return;
+				}
+			}
+			throw std::logic_error("No perfect hash seed found");
+		}
+
+		// Option with the given name, or null
+		constexpr Option<Values> const* find(std::string_view name) const {
+			if (name.size() > m_MaxNameSize) {
+				return nullptr;
+			}
+			std::uint8_t slot = m_Slots[hashName(name, m_Seed) & (kSlots - 1)];
+			if (0 == slot || m_Options[slot - 1].name != name) {
+				return nullptr;
+			}
+			return &m_Options[slot - 1];
+		}
+
+		// Parses `argv[1]' to `argv[argc - 1]' into `values'. Takes the
+		// `argv' of `main' as well as a vector of constant strings.
+		template <typename CharPointer>
+		ParseResult parse(int argc, CharPointer* argv, Values& values) const {
+			static_assert(
+				std::is_same_v<CharPointer, char*>
+				|| std::is_same_v<CharPointer, char const*>,
+				"Arguments must be C strings"
+			);
+			ParseResult result;
+			int unsupported = 1;
+
+			for (int i = 1; i < argc; ++i) {
+				std::string_view arg{argv[i]};
+				Option<Values> const* option =
+					(!arg.empty() && '-' == arg.front()) ? find(arg) : nullptr;
+
+				if (nullptr == option) {
+					argv[unsupported++] = argv[i];
+				} else if (OptionKind::Flag == option->kind) {
+					values.*(option->flag) = true;
+				} else if (i + 1 < argc && '\0' != argv[i + 1][0]) {
+					values.*(option->value) = argv[++i];
+				} else {
+					result.missing_value = option->name;
+				}
+			}
+
+			std::size_t others = static_cast<std::size_t>(unsupported - 1);
+			if (nullptr != m_Positionals) {
+				// Stable partition in place, command lines are short
+				std::size_t positional = 0;
+				for (std::size_t i = 0; i < others; ++i) {
+					char const* arg = argv[1 + i];
+					if ('-' != arg[0]) {
+						std::rotate(
+							argv + 1 + positional,
+							argv + 1 + i,
+							argv + 2 + i
+						);
+						++positional;
+					}
+				}
+				values.*m_Positionals = ArgSpan{argv + 1, positional};
+				values.*m_Unsupported = ArgSpan{
+					argv + 1 + positional,
+					others - positional
+				};
+			} else {
+				values.*m_Unsupported = ArgSpan{argv + 1, others};
+			}
+
+			return result;
+		}
+
+		constexpr std::array<Option<Values>, Count> const& options() const {
+			return m_Options;
+		}
+
+	private:
+		constexpr bool tryPlace(std::uint32_t seed) {
+			for (auto& slot : m_Slots) {
+				slot = 0;
+			}
+			for (std::size_t i = 0; i < Count; ++i) {
+				std::size_t index = hashName(m_Options[i].name, seed)
+					& (kSlots - 1);
+				if (0 != m_Slots[index]) {
+					return false;
+				}
+				m_Slots[index] = static_cast<std::uint8_t>(i + 1);
+			}
+			return true;
+		}
+
+		ArgSpan Values::* m_Unsupported;
+		ArgSpan Values::* m_Positionals;  // Null if not enabled
+		std::array<Option<Values>, Count> m_Options;
+		std::array<std::uint8_t, kSlots> m_Slots{};  // Option index + 1
+		std::uint32_t m_Seed{0};
+		std::size_t m_MaxNameSize{0};
+	};
+
+	// Builds the option table, at compile time when used to initialize a
+	// constexpr variable
+	template <typename Values, typename... Options>
+	constexpr OptionTable<Values, sizeof...(Options)> makeOptionTable(
+		ArgSpan Values::* unsupported,
+		Options const&... options
+	) {
+		return OptionTable<Values, sizeof...(Options)>{
+			unsupported,
+			nullptr,
+			{{options...}}
+		};
+	}
+
+	// Builds the option table with the positional arguments
+	template <typename Values, typename... Options>
+	constexpr OptionTable<Values, sizeof...(Options)> makeOptionTable(
+		ArgSpan Values::* unsupported,
+		Positionals<Values> positionals,
+		Options const&... options
+	) {
+		return OptionTable<Values, sizeof...(Options)>{
+			unsupported,
+			positionals.target,
+			{{options...}}
+		};
+	}
+
+};
+
+// End of `argv_parser.hxx'
@@ -0,0 +1,173 @@
+// ============================================================================
+//
+// File:        batch_server.hxx
+// Description: Long-running batch mode that reads argument vectors from
+//              a stream or a local socket and dispatches each of them through
+//              a single request handler
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * batch_server.hxx: created.
+// * batch_server.hxx: request handlers write to output sinks instead of
+//   the captured standard streams.
+// * batch_server.hxx: empty requests are skipped, `serveUnixSocket' reports
+//   its errors to an error sink.
+// * batch_server.hxx: read errors are kept by the request reader and
+//   reported by `serveStream'.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "output_sinks.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// Batch Server Section
+// ============================================================================
+
+namespace BatchServer {
+	constexpr std::size_t DEFAULT_READ_BUFFER_SIZE{64 * 1024};
+
+	// ------------------------------------------------------------------------
+	// RecordFormat
+	// ------------------------------------------------------------------------
+	//
+	// Description: Framing of the incoming argument vectors.
+	//
+	//              Lines:         one request per line, arguments separated
+	//                             by blanks (no quoting).
+	//              NullDelimited: every argument is terminated by a NUL byte,
+	//                             and an empty argument (two consecutive NUL
+	//                             bytes) terminates the request.
+	//
+	// ------------------------------------------------------------------------
+	enum class RecordFormat { Lines, NullDelimited };
+
+	using ArgList = std::vector<std::string>;
+
+	// Request handler receives the argument vector of a single request
+	// (without the program name) and the sinks for its regular and its error
+	// output, and returns the exit status of the action. Everything written
+	// to the sinks is sent back as a part of the reply.
+	using RequestHandler = std::function<int(
+		ArgList const&,
+		OutputSinks::OutputSink&,
+		OutputSinks::OutputSink&
+	)>;
+
+	// ------------------------------------------------------------------------
+	// RequestReader
+	// ------------------------------------------------------------------------
+	//
+	// Description: Splits the byte stream read from a file descriptor into
+	//              argument vectors. The read buffer is reused between the
+	//              requests and only grows when a single record does not fit.
+	//              Requests without any argument (blank lines, a lone empty
+	//              argument) are skipped. A read error ends the stream, the
+	//              partial request read before it is dropped.
+	//
+	// ------------------------------------------------------------------------
+	class RequestReader {
+	public:
+		explicit RequestReader(
+			int fd,
+			RecordFormat format,
+			std::size_t buffer_size = DEFAULT_READ_BUFFER_SIZE
+		);
+
+		// Reads the next request into `args'. Returns false on end of stream
+		// or on a read error.
+		bool next(ArgList& args);
+
+		// `errno' value of the read error, zero if none
+		int error() const {
+			return m_Error;
+		}
+
+	private:
+		bool nextRecord(std::string_view& record, char delimiter);
+
+		int m_Fd;
+		RecordFormat m_Format;
+		std::vector<char> m_Buffer;
+		std::size_t m_Begin;
+		std::size_t m_End;
+		bool m_Eof;
+		int m_Error;
+	};
+
+	// ------------------------------------------------------------------------
+	// Reply framing
+	// ------------------------------------------------------------------------
+	//
+	// Every request is answered with a single frame:
+	//
+	//     <status> <stdout bytes> <stderr bytes>\n<stdout data><stderr data>
+	//
+	// where the header fields are decimal numbers. Frames are written with a
+	// single gathered write, so replies to concurrent readers of a pipe are
+	// never interleaved.
+	//
+	// ------------------------------------------------------------------------
+
+	// Serves requests read from `in_fd' and writes replies to `out_fd' until
+	// the end of input. Returns EXIT_SUCCESS, or EXIT_FAILURE if the requests
+	// could not be read (reported to `err') or a reply could not be written.
+	int serveStream(
+		int in_fd,
+		int out_fd,
+		RecordFormat format,
+		RequestHandler const& handler,
+		OutputSinks::OutputSink& err = OutputSinks::standardError()
+	);
+
+	// Binds a Unix domain socket at `path' and serves connecting clients one
+	// at a time, each one with `serveStream'. Returns only on error, which
+	// is reported to `err'.
+	int serveUnixSocket(
+		std::string const& path,
+		RecordFormat format,
+		RequestHandler const& handler,
+		OutputSinks::OutputSink& err = OutputSinks::standardError()
+	);
+};
+
+// End of `batch_server.hxx'
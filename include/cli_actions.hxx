@@ -35,6 +35,23 @@
 //
 // * cli_actions.hxx: created.
 //
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * cli_actions.hxx: strategies now receive an `ActionContext' so they can be
+//   executed through `StaticCliAction' as well as through `CliAction'.
+// * cli_actions.hxx: added `ShowStaticTextStrategy' and `pageFormatting()'.
+// * cli_actions.hxx: strategies write to the output sinks of the action
+//   context instead of `std::cout' and `std::cerr'.
+// * cli_actions.hxx: `CliAction::execute()' is a trace point.
+// * cli_actions.hxx: `UnsupportedOptionsStrategyClipp' takes a view of the
+//   unsupported arguments.
+// * cli_actions.hxx: actions carry a memory arena, strategies view their
+//   data instead of copying it, clipp renders straight into the sinks.
+// * cli_actions.hxx: removed `makeAction', the arena never destroyed the
+//   strategy copies it held.
+// * cli_actions.hxx: added `MissingArgumentStrategy' showing a usage text
+//   rendered in advance.
+//
 // ============================================================================
 
 #pragma once
@@ -44,11 +61,16 @@
 // ============================================================================
 
 // Project library headers
+#include "argv_parser.hxx"
 #include "common.hxx"
+#include "output_sinks.hxx"
+#include "tracing.hxx"
 
 // Standard library headers
 #include <functional>
-#include <iostream>
+#include <memory_resource>
+#include <ostream>
+#include <string>
 #include <string_view>
 
 // External library headers
@@ -62,6 +84,64 @@ namespace CliActions {
 	constexpr int DEFAULT_PAGE_IDENT{0};
 	constexpr int DEFAULT_PAGE_WIDTH{79};
 
+	// Formatting used for the help and usage pages
+	inline clipp::doc_formatting pageFormatting() {
+		return clipp::doc_formatting{}
+			.first_column(DEFAULT_PAGE_IDENT)
+			.last_column(DEFAULT_PAGE_WIDTH);
+	}
+
+	// ------------------------------------------------------------------------
+	// ActionContext
+	// ------------------------------------------------------------------------
+	//
+	// Description: Execution context handed to the strategies. It refers to
+	//              the execution name, to the output sinks the strategies
+	//              write to and to the memory arena the strategies take their
+	//              scratch memory from. It does not copy them, so they must
+	//              outlive the context.
+	//
+	// ------------------------------------------------------------------------
+	class ActionContext {
+	public:
+		explicit ActionContext(
+			std::string_view const& exec_name,
+			OutputSinks::OutputSink& out = OutputSinks::standardOutput(),
+			OutputSinks::OutputSink& err = OutputSinks::standardError(),
+			std::pmr::memory_resource& arena = *std::pmr::get_default_resource()
+		) : m_ExecName{exec_name},
+			m_Out{&out},
+			m_Err{&err},
+			m_Arena{&arena}
+		{ }
+
+		std::string_view execName() const {
+			return this->m_ExecName;
+		}
+
+		// Sink for the regular output
+		OutputSinks::OutputSink& out() const {
+			return *this->m_Out;
+		}
+
+		// Sink for the diagnostics
+		OutputSinks::OutputSink& err() const {
+			return *this->m_Err;
+		}
+
+		// Memory released all at once when the run ends (e.g. a
+		// `std::pmr::monotonic_buffer_resource' in `main()')
+		std::pmr::memory_resource& arena() const {
+			return *this->m_Arena;
+		}
+
+	private:
+		std::string_view m_ExecName;
+		OutputSinks::OutputSink* m_Out;
+		OutputSinks::OutputSink* m_Err;
+		std::pmr::memory_resource* m_Arena;
+	};
+
 	// ------------------------------------------------------------------------
 	// CliAction
 	// ------------------------------------------------------------------------
@@ -69,32 +149,37 @@ namespace CliActions {
 	// Description: Command-line action wrapper using the strategy pattern for
 	//              flexible execution.
 	//
-    //              Accepts a callable strategy at construction that defines how
-    //              the action executes. The strategy receives the action
-    //              instance and an execution name identifier.
+	//              Accepts a callable strategy at construction that defines how
+	//              the action executes. The strategy receives the action
+	//              instance and an execution name identifier.
+	//
+	//              For a fixed set of strategies known at compile time prefer
+	//              `StaticCliAction' (see action_registry.hxx), which avoids
+	//              the type erasure and the virtual call. To keep a large
+	//              strategy off the heap hand the action a callable viewing
+	//              it, which fits into the inline storage of `std::function'.
 	//
 	// ------------------------------------------------------------------------
-	class CliAction {
+	class CliAction : public ActionContext {
 	public:
 		using ExecutiveStrategy = std::function<int(CliAction const&)>;
 
 		explicit CliAction(
 			std::string_view const& exec_name,
-			ExecutiveStrategy executor
-		) : m_ExecName{exec_name},
+			ExecutiveStrategy executor,
+			OutputSinks::OutputSink& out = OutputSinks::standardOutput(),
+			OutputSinks::OutputSink& err = OutputSinks::standardError(),
+			std::pmr::memory_resource& arena = *std::pmr::get_default_resource()
+		) : ActionContext{exec_name, out, err, arena},
 			m_Executor{std::move(executor)}
 		{ }
 
 		int execute() const {
+			TRACE_SCOPE("CliAction::execute");
 			return m_Executor(*this);
 		}
 
-		std::string_view execName() const {
-			return std::string_view{this->m_ExecName};
-		}
-
 	private:
-		const std::string m_ExecName;
 		const ExecutiveStrategy m_Executor;
 	};
 
@@ -112,8 +197,8 @@ namespace CliActions {
 	    virtual ~BaseStrategy() = default;
 	
 	    // Pure virtual function that must be implemented by derived classes
-	    // Takes two const reference arguments and must be overridden
-	    virtual int operator()(CliAction const& action) const = 0;
+	    // Takes the execution context and must be overridden
+	    virtual int operator()(ActionContext const& action) const = 0;
 		
 	protected:
 	    // Protected constructor prevents direct instantiation
@@ -130,7 +215,8 @@ namespace CliActions {
 	// ShowHelpStrategyClipp
 	// ------------------------------------------------------------------------
 	//
-	// Description: Strategy for displaying help information about the program
+	// Description: Strategy for displaying help information about the program.
+	//              The option group and the texts are referenced, not copied.
 	//
 	// ------------------------------------------------------------------------
 	class ShowHelpStrategyClipp : public BaseStrategy {
@@ -145,10 +231,8 @@ namespace CliActions {
 		{ }
 	
 		// Shows help information
-		int operator()(CliAction const& action) const override {
-			auto fmt = clipp::doc_formatting{}
-				.first_column(DEFAULT_PAGE_IDENT)
-				.last_column(DEFAULT_PAGE_WIDTH);
+		int operator()(ActionContext const& action) const override {
+			auto fmt = pageFormatting();
 			clipp::man_page man;
 			
 			man.prepend_section(
@@ -168,16 +252,51 @@ namespace CliActions {
 				"",
 				"Report bugs to <" + std::string {m_AuthorEmail} + ">."
 			);
-		
-			std::cout << man;
+
+			// clipp renders the page into a stream only
+			OutputSinks::SinkStreamBuffer buffer{action.out()};
+			std::ostream page{&buffer};
+			page << man;
 		
 			return EXIT_SUCCESS;
 		}
   
 	private:
-		clipp::group m_Group;
-		std::string m_AppDoc;
-		std::string m_AuthorEmail;
+		clipp::group const& m_Group;
+		std::string_view m_AppDoc;
+		std::string_view m_AuthorEmail;
+	};
+
+	// ------------------------------------------------------------------------
+	// ShowStaticTextStrategy
+	// ------------------------------------------------------------------------
+	//
+	// Description: Strategy for displaying a text rendered in advance (e.g.
+	//              the help page rendered at build time, see
+	//              help_text_generator.cxx). The text is handed to the output
+	//              sink as static data, so it is not copied and it goes out
+	//              with a single write. The text must outlive the flush of
+	//              the sink.
+	//
+	// ------------------------------------------------------------------------
+	class ShowStaticTextStrategy : public BaseStrategy {
+	public:
+		explicit ShowStaticTextStrategy(
+			std::string_view const& text,
+			int status = EXIT_SUCCESS
+		) : m_Text(text), m_Status(status)
+		{ }
+
+		// Shows the text
+		int operator()(ActionContext const& action) const override {
+			action.out().writeStatic(m_Text);
+
+			return m_Status;
+		}
+
+	private:
+		std::string_view m_Text;
+		int m_Status;
 	};
 
 	// ------------------------------------------------------------------------
@@ -193,11 +312,11 @@ namespace CliActions {
 		explicit ShowShortHelpStrategy() = default;
 
 		// Shows short help message
-		int operator()(CliAction const& action) const override {
-			std::cout << "\n";
+		int operator()(ActionContext const& action) const override {
+			action.out() << "\n";
 
 			// Print short help message
-			std::cout << "Try '"
+			action.out() << "Try '"
 				<< action.execName()
 				<< " --help' for more information.\n";
 
@@ -209,7 +328,8 @@ namespace CliActions {
 	// ShowUsageStrategyClipp
 	// ------------------------------------------------------------------------
 	//
-	// Description: Strategy for displaying usage information about the program
+	// Description: Strategy for displaying usage information about the program.
+	//              The option group is referenced, not copied.
 	//
 	// ------------------------------------------------------------------------
 	class ShowUsageStrategyClipp : public BaseStrategy {
@@ -221,8 +341,10 @@ namespace CliActions {
 		{ }
 
 		// Shows usage information
-		int operator()(CliAction const& action) const override {
-			std::cout << clipp::usage_lines(
+		int operator()(ActionContext const& action) const override {
+			OutputSinks::SinkStreamBuffer buffer{action.out()};
+			std::ostream usage{&buffer};
+			usage << clipp::usage_lines(
 				m_Group,
 				std::string {action.execName()},
 				m_Format
@@ -232,7 +354,7 @@ namespace CliActions {
 		}
 
 	private:
-		clipp::group m_Group;
+		clipp::group const& m_Group;
 		clipp::doc_formatting m_Format;
 	};
 
@@ -258,8 +380,8 @@ namespace CliActions {
 		{ }
 
 		// Shows version information
-		int operator()(CliAction const& action) const override {
-			std::cout << action.execName() << " "
+		int operator()(ActionContext const& action) const override {
+			action.out() << action.execName() << " "
 				<< m_AppVersion << " Copyright (C) "
 				<< m_ReleaseYear << " "
 				<< m_AuthorName << "\n"
@@ -269,10 +391,10 @@ namespace CliActions {
 		}
 
 	private:
-		std::string m_AppVersion;
-		std::string m_ReleaseYear;
-		std::string m_AuthorName;
-		std::string m_License;
+		std::string_view m_AppVersion;
+		std::string_view m_ReleaseYear;
+		std::string_view m_AuthorName;
+		std::string_view m_License;
 	};
 
 	// ------------------------------------------------------------------------
@@ -280,40 +402,41 @@ namespace CliActions {
 	// ------------------------------------------------------------------------
 	//
 	// Description: Strategy for displaying aggregated unsupported options
-	//              and short help message about the program using
-	//              Clipp library
+	//              and short help message about the program. The arguments
+	//              are viewed, not copied, so they must outlive the strategy.
 	//
 	// ------------------------------------------------------------------------
 	class UnsupportedOptionsStrategyClipp : public BaseStrategy {
 	public:
 		explicit UnsupportedOptionsStrategyClipp(
-			std::vector<std::string> const& unsupported_options
+			ArgvParser::ArgSpan unsupported_options
 		) : m_UnsupportedOptions(unsupported_options) { }
 
 		// Shows aggregated unsupported options and short help message
-		int operator()(CliAction const& action) const override {
-			std::cerr << action.execName() << ": Unsupported options: ";
+		int operator()(ActionContext const& action) const override {
+			action.err() << action.execName() << ": Unsupported options: ";
 			for (const auto& opt : m_UnsupportedOptions) {
-				std::cerr << opt << " ";
+				action.err() << opt << " ";
 			}
-			std::cerr << "\n";
+			action.err() << "\n";
 
 			// Print short help message
-			std::cout << "Try '" << action.execName()
+			action.out() << "Try '" << action.execName()
 				<< " --help' for more information.\n";
 
 			return EXIT_FAILURE;
 		}
 
 	private:
-		std::vector<std::string> const& m_UnsupportedOptions;
+		ArgvParser::ArgSpan m_UnsupportedOptions;
 	};
 
 	// ------------------------------------------------------------------------
 	// MissingArgumentStrategyClipp
 	// ------------------------------------------------------------------------
 	//
-	// Description: Strategy for displaying error on missing argument
+	// Description: Strategy for displaying error on missing argument. The
+	//              message and the option group are referenced, not copied.
 	//
 	// ------------------------------------------------------------------------
 	class MissingArgumentStrategyClipp : public BaseStrategy {
@@ -326,10 +449,12 @@ namespace CliActions {
 		{ }
 
 		// Shows error message and short usage
-		int operator()(CliAction const& action) const override {
-			std::cerr << action.execName() << ": ERROR: "
+		int operator()(ActionContext const& action) const override {
+			action.err() << action.execName() << ": ERROR: "
 				<< m_ErrorMessage << "\n";
-			std::cout << "Usage: " << clipp::usage_lines(
+			OutputSinks::SinkStreamBuffer buffer{action.out()};
+			std::ostream usage{&buffer};
+			usage << "Usage: " << clipp::usage_lines(
 				m_Group,
 				std::string {action.execName()},
 				m_Format
@@ -339,11 +464,43 @@ namespace CliActions {
 		}
 
 	private:
-		std::string m_ErrorMessage;
-		clipp::group m_Group;
+		std::string_view m_ErrorMessage;
+		clipp::group const& m_Group;
 		clipp::doc_formatting m_Format;
 	};
 
+	// ------------------------------------------------------------------------
+	// MissingArgumentStrategy
+	// ------------------------------------------------------------------------
+	//
+	// Description: Strategy for displaying error on missing argument, with
+	//              the short usage rendered in advance (see
+	//              `ShowStaticTextStrategy'). The message and the usage are
+	//              viewed, not copied, and nothing is allocated.
+	//
+	// ------------------------------------------------------------------------
+	class MissingArgumentStrategy : public BaseStrategy {
+	public:
+		explicit MissingArgumentStrategy(
+			std::string_view const& errorMessage,
+			std::string_view const& usage
+		) : m_ErrorMessage(errorMessage), m_Usage(usage)
+		{ }
+
+		// Shows error message and short usage
+		int operator()(ActionContext const& action) const override {
+			action.err() << action.execName() << ": ERROR: "
+				<< m_ErrorMessage << "\n";
+			action.out().writeStatic(m_Usage);
+
+			return EXIT_FAILURE;
+		}
+
+	private:
+		std::string_view m_ErrorMessage;
+		std::string_view m_Usage;
+	};
+
 };
 
 // End of `cli_actions.hxx`
@@ -34,10 +34,31 @@
 //
 // * cli_template_app.hxx: created.
 //
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * cli_template_app.hxx: added batch mode options (`--serve', `--socket',
+//   `--null').
+// * cli_template_app.hxx: added the documentation strategy factories shared
+//   with the help text generator.
+// * cli_template_app.hxx: documented the `--trace=FILE' option and added the
+//   tracing environment variable name.
+// * cli_template_app.hxx: added `CliOptionViews' and the allocation-free
+//   option table the program parses with. The clipp parser is built on
+//   first use (`appOptions()') and serves the documentation only.
+// * cli_template_app.hxx: added the size of the per-run memory arena.
+// * cli_template_app.hxx: added the input files and the input options
+//   (`--grep', `--input-backend').
+// * cli_template_app.hxx: added the `--count' input option.
+// * cli_template_app.hxx: added the directory walk options (`--walk',
+//   `--jobs', `--sort').
+// * cli_template_app.hxx: documented the limit of `--jobs'.
+//
 // ============================================================================
 
 
 // Project headers
+#include "argv_parser.hxx"
+#include "cli_actions.hxx"
 #include "common.hxx"
 
 // External library headers
@@ -51,7 +72,52 @@
 static constexpr std::string_view kAppName = "cli_template_app";
 static constexpr std::string_view kAppDoc = "\
 A small CLI program to demonstrate the use of the framework.\n\n\
-Mandatory arguments to long options are mandatory for short options too.\n";
+Mandatory arguments to long options are mandatory for short options too.\n\n\
+In batch mode (--serve) the program reads argument vectors from the standard\n\
+input or from a Unix domain socket, one request per line (or NUL terminated\n\
+arguments with an empty argument closing the request when --null is given),\n\
+and answers each one with a frame `<status> <stdout bytes> <stderr bytes>'\n\
+followed by the captured output.\n\n\
+With --trace=FILE (or the CLI_TEMPLATE_APP_TRACE environment variable set to\n\
+FILE) the program records the time spent in its phases, writes them to FILE\n\
+in the Chrome trace event format and prints a summary to the standard error.\n\n\
+With --grep PATTERN the program prints the lines of the FILEs (or of the\n\
+standard input) containing PATTERN. The input is streamed in large chunks\n\
+read by the --input-backend: auto, mmap, read (double buffered) or io_uring.\n\n\
+With --count the program prints the number of lines and bytes of each FILE,\n\
+as `wc -lc' does.\n\n\
+With --walk the program lists the size and the path of every file under the\n\
+FILEs (directories, the current directory if none is given), read by --jobs\n\
+worker threads (the number of CPUs by default) stealing directories from\n\
+each other. Files are listed as they are found unless --sort is given.\n";
+
+// Environment variable enabling the tracing when `--trace=FILE' is not given
+static constexpr auto kTraceEnvVar = "CLI_TEMPLATE_APP_TRACE";
+
+// Stack storage of the memory arena of a run (or of a batch mode request).
+// The arena falls back to the heap only once it is exhausted.
+static constexpr std::size_t kArenaSize{16 * 1024};
+
+static constexpr std::string_view kServeOptionDoc = "\
+serve requests read from the standard input until end of input";
+static constexpr std::string_view kSocketOptionDoc = "\
+serve requests on a Unix domain socket at PATH (implies --serve)";
+static constexpr std::string_view kNullOptionDoc = "\
+requests are NUL terminated arguments closed by an empty argument";
+static constexpr std::string_view kInputFilesDoc = "\
+files or directories (--walk) to read, the standard input if none is given";
+static constexpr std::string_view kGrepOptionDoc = "\
+print the lines of the input containing PATTERN";
+static constexpr std::string_view kCountOptionDoc = "\
+print the line and byte counts of the input";
+static constexpr std::string_view kWalkOptionDoc = "\
+list the files under the directories with their sizes";
+static constexpr std::string_view kJobsOptionDoc = "\
+walk the directories on N threads, up to 8 per CPU (default: one per CPU)";
+static constexpr std::string_view kSortOptionDoc = "\
+list the walked files sorted by path";
+static constexpr std::string_view kInputBackendOptionDoc = "\
+read the input with auto (default), mmap, read or io_uring";
 
 
 // ============================================================================
@@ -69,15 +135,78 @@ struct CliOptionValues
     bool m_ShowHelp;
     bool m_PrintUsage;
     bool m_ShowVersion;
+    bool m_Serve;
+    bool m_ServeNullDelimited;
+    std::string m_ServeSocket;
+    std::vector<std::string> m_Inputs;
+    std::string m_GrepPattern;
+    bool m_Count;
+    bool m_Walk;
+    std::string m_Jobs;
+    bool m_Sort;
+    std::string m_InputBackend;
 };
 
 // Define the default values for the command line options
-static CliOptionValues userOptionValues
+static const CliOptionValues kDefaultOptionValues
 {
     {},     // m_Unsupported
     false,  // m_ShowHelp
     false,  // m_PrintUsage
-    false   // m_ShowVersion
+    false,  // m_ShowVersion
+    false,  // m_Serve
+    false,  // m_ServeNullDelimited
+    {},     // m_ServeSocket
+    {},     // m_Inputs
+    {},     // m_GrepPattern
+    false,  // m_Count
+    false,  // m_Walk
+    {},     // m_Jobs
+    false,  // m_Sort
+    {}      // m_InputBackend
+};
+
+// Parsed option values. The parser binds to this very object, so to parse
+// another argument vector reset it by assignment from the defaults
+static CliOptionValues userOptionValues{kDefaultOptionValues};
+
+// Same options as `CliOptionValues', parsed by `kOptionTable' without any
+// allocation. Strings are views into the parsed argument vector.
+struct CliOptionViews
+{
+    ArgvParser::ArgSpan m_Unsupported;  // Arguments that do not fit any of
+                                        // the provided options
+    bool m_ShowHelp;
+    bool m_PrintUsage;
+    bool m_ShowVersion;
+    bool m_Serve;
+    bool m_ServeNullDelimited;
+    std::string_view m_ServeSocket;
+    ArgvParser::ArgSpan m_Inputs;  // Positional arguments
+    std::string_view m_GrepPattern;
+    bool m_Count;
+    bool m_Walk;
+    std::string_view m_Jobs;
+    bool m_Sort;
+    std::string_view m_InputBackend;
+};
+
+static constexpr CliOptionViews kDefaultOptionViews
+{
+    {},     // m_Unsupported
+    false,  // m_ShowHelp
+    false,  // m_PrintUsage
+    false,  // m_ShowVersion
+    false,  // m_Serve
+    false,  // m_ServeNullDelimited
+    {},     // m_ServeSocket
+    {},     // m_Inputs
+    {},     // m_GrepPattern
+    false,  // m_Count
+    false,  // m_Walk
+    {},     // m_Jobs
+    false,  // m_Sort
+    {}      // m_InputBackend
 };
 
 
@@ -85,34 +214,143 @@ static CliOptionValues userOptionValues
 // Parser Setup Section
 // ============================================================================
 
-auto appOptions = (
-    // Define the command line options and their default values.
-    // - Must have more than one option.
-    // - The order of the options is important.
-    // - The order of the options in the group is important.
-    // - Take care not to omitt value filter when parsing file
-    //   and directory names. Otherwise, the parser will treat options
-    //   as values.
-    // - Define positional arguments first
-    // - Define positional srguments as optional to enforce
-    //   the priority of help, usage and version switches. Then enforce
-    //   the required positional arguments by checking if their
-    //   values are set.
-    (
+// Built on first use, as only the documentation strategies need it. Must
+// accept exactly the options of `kOptionTable' below.
+static inline clipp::group& appOptions()
+{
+    static clipp::group options = (
+        // Define the command line options and their default values.
+        // - Must have more than one option.
+        // - The order of the options is important.
+        // - The order of the options in the group is important.
+        // - Take care not to omitt value filter when parsing file
+        //   and directory names. Otherwise, the parser will treat options
+        //   as values.
+        // - Define positional arguments first
+        // - Define positional srguments as optional to enforce
+        //   the priority of help, usage and version switches. Then enforce
+        //   the required positional arguments by checking if their
+        //   values are set.
+        clipp::values(
+            clipp::match::prefix_not("-"),
+            "FILE",
+            userOptionValues.m_Inputs
+        ).doc(kInputFilesDoc.data()),
         (
-            clipp::option("-h", "--help")
-                .set(userOptionValues.m_ShowHelp)
-        ).doc(kHelpOptionDoc.data()),
+            (
+                clipp::option("-h", "--help")
+                    .set(userOptionValues.m_ShowHelp)
+            ).doc(kHelpOptionDoc.data()),
+            (
+                clipp::option("--usage")
+                    .set(userOptionValues.m_PrintUsage)
+            ).doc(kUsageOptionDoc.data()),
+            (
+                clipp::option("-V", "--version")
+                    .set(userOptionValues.m_ShowVersion)
+            ).doc(kVersionOptionDoc.data())
+        ).doc("general options:"),
         (
-            clipp::option("--usage")
-                .set(userOptionValues.m_PrintUsage)
-        ).doc(kUsageOptionDoc.data()),
+            (
+                clipp::option("--serve")
+                    .set(userOptionValues.m_Serve)
+            ).doc(kServeOptionDoc.data()),
+            (
+                clipp::option("--socket")
+                & clipp::value("PATH", userOptionValues.m_ServeSocket)
+            ).doc(kSocketOptionDoc.data()),
+            (
+                clipp::option("-0", "--null")
+                    .set(userOptionValues.m_ServeNullDelimited)
+            ).doc(kNullOptionDoc.data())
+        ).doc("batch mode options:"),
         (
-            clipp::option("-V", "--version")
-                .set(userOptionValues.m_ShowVersion)
-        ).doc(kVersionOptionDoc.data())
-    ).doc("general options:"),
-    clipp::any_other(userOptionValues.m_Unsupported)
+            (
+                clipp::option("--grep")
+                & clipp::value("PATTERN", userOptionValues.m_GrepPattern)
+            ).doc(kGrepOptionDoc.data()),
+            (
+                clipp::option("--count")
+                    .set(userOptionValues.m_Count)
+            ).doc(kCountOptionDoc.data()),
+            (
+                clipp::option("--walk")
+                    .set(userOptionValues.m_Walk)
+            ).doc(kWalkOptionDoc.data()),
+            (
+                clipp::option("--jobs")
+                & clipp::value("N", userOptionValues.m_Jobs)
+            ).doc(kJobsOptionDoc.data()),
+            (
+                clipp::option("--sort")
+                    .set(userOptionValues.m_Sort)
+            ).doc(kSortOptionDoc.data()),
+            (
+                clipp::option("--input-backend")
+                & clipp::value("NAME", userOptionValues.m_InputBackend)
+            ).doc(kInputBackendOptionDoc.data())
+        ).doc("input options:"),
+        clipp::any_other(userOptionValues.m_Unsupported)
+    );
+
+    return options;
+}
+
+// Option table of the allocation-free parser, checked against `appOptions()'
+// by the differential tests (tests/argv_parser_test.cxx)
+static constexpr auto kOptionTable = ArgvParser::makeOptionTable(
+    &CliOptionViews::m_Unsupported,
+    ArgvParser::positionals(&CliOptionViews::m_Inputs),
+    ArgvParser::flag("-h", &CliOptionViews::m_ShowHelp),
+    ArgvParser::flag("--help", &CliOptionViews::m_ShowHelp),
+    ArgvParser::flag("--usage", &CliOptionViews::m_PrintUsage),
+    ArgvParser::flag("-V", &CliOptionViews::m_ShowVersion),
+    ArgvParser::flag("--version", &CliOptionViews::m_ShowVersion),
+    ArgvParser::flag("--serve", &CliOptionViews::m_Serve),
+    ArgvParser::value("--socket", &CliOptionViews::m_ServeSocket),
+    ArgvParser::flag("-0", &CliOptionViews::m_ServeNullDelimited),
+    ArgvParser::flag("--null", &CliOptionViews::m_ServeNullDelimited),
+    ArgvParser::value("--grep", &CliOptionViews::m_GrepPattern),
+    ArgvParser::flag("--count", &CliOptionViews::m_Count),
+    ArgvParser::flag("--walk", &CliOptionViews::m_Walk),
+    ArgvParser::value("--jobs", &CliOptionViews::m_Jobs),
+    ArgvParser::flag("--sort", &CliOptionViews::m_Sort),
+    ArgvParser::value("--input-backend", &CliOptionViews::m_InputBackend)
 );
 
+
+// ============================================================================
+// Documentation Strategies Section
+// ============================================================================
+
+// Strategies rendering the program documentation. They are shared by `main()'
+// and by the build-time help text generator (help_text_generator.cxx), so the
+// pre-rendered texts are exactly what these strategies print at runtime.
+static inline CliActions::ShowHelpStrategyClipp makeShowHelpStrategy()
+{
+    return CliActions::ShowHelpStrategyClipp(
+        appOptions(),
+        kAppDoc,
+        kAuthorEmail
+    );
+}
+
+static inline CliActions::ShowUsageStrategyClipp makeShowUsageStrategy()
+{
+    return CliActions::ShowUsageStrategyClipp(
+        appOptions(),
+        CliActions::pageFormatting()
+    );
+}
+
+static inline CliActions::ShowVersionInfoStrategy makeShowVersionStrategy()
+{
+    return CliActions::ShowVersionInfoStrategy(
+        kVersionString,
+        kYearString,
+        kCopyrightHolder,
+        kLicense
+    );
+}
+
 // End of 'cli_template_app.hxx'
@@ -0,0 +1,89 @@
+// ============================================================================
+//
+// File:        count_strategy.hxx
+// Description: Streaming input strategy counting the lines and the bytes of
+//              its inputs, as `wc -lc'
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * count_strategy.hxx: created.
+// * count_strategy.hxx: the chunks are counted as they are read.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "argv_parser.hxx"
+#include "cli_actions.hxx"
+#include "streaming_input_strategy.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <string_view>
+
+// ============================================================================
+// Strategy Declaration Section
+// ============================================================================
+
+// Prints the number of lines (of delimiters) and of bytes of each input,
+// followed by the input name (none for the standard input), and the totals
+// when there are more inputs than one. The delimiters are counted by the
+// text kernels (see text_kernels.hxx) right in the chunks of the input, so
+// nothing is copied and the memory used does not depend on the length of
+// the lines. A last line without a delimiter is not counted, as `wc -l'
+// does not count it. Fails if an input could not be read.
+class CountStrategy : public CliActions::StreamingInputStrategy {
+public:
+	explicit CountStrategy(
+		ArgvParser::ArgSpan inputs,
+		CliActions::InputOptions const& options = CliActions::InputOptions{}
+	) : StreamingInputStrategy{inputs, options}
+	{ }
+
+	int operator()(CliActions::ActionContext const& action) const override;
+
+private:
+	struct Counts {
+		std::size_t lines{0};
+		std::size_t bytes{0};
+	};
+
+	static void print(
+		CliActions::ActionContext const& action,
+		Counts const& counts,
+		std::string_view name
+	);
+};
+
+// End of `count_strategy.hxx'
@@ -0,0 +1,75 @@
+// ============================================================================
+//
+// File:        grep_strategy.hxx
+// Description: Sample streaming input strategy printing the lines that
+//              contain a fixed string
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * grep_strategy.hxx: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "argv_parser.hxx"
+#include "cli_actions.hxx"
+#include "streaming_input_strategy.hxx"
+
+// Standard library headers
+#include <string_view>
+
+// ============================================================================
+// Strategy Declaration Section
+// ============================================================================
+
+// Prints the lines of the inputs containing the pattern (a fixed string, as
+// `grep -F'), prefixed with the input name when there are more inputs than
+// one. Fails if no line matched or an input could not be read.
+class GrepStrategy : public CliActions::StreamingInputStrategy {
+public:
+	explicit GrepStrategy(
+		std::string_view const& pattern,
+		ArgvParser::ArgSpan inputs,
+		CliActions::InputOptions const& options = CliActions::InputOptions{}
+	) : StreamingInputStrategy{inputs, options}, m_Pattern{pattern}
+	{ }
+
+	int operator()(CliActions::ActionContext const& action) const override;
+
+private:
+	std::string_view m_Pattern;
+};
+
+// End of `grep_strategy.hxx'
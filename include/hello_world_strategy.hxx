@@ -33,6 +33,10 @@
 //
 // * hello_world_strategy.hxx: created.
 //
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * hello_world_strategy.hxx: strategy takes `ActionContext' instead of `CliAction'.
+//
 // ============================================================================
 
 #pragma once
@@ -50,7 +54,7 @@
 
 class HelloWorldStrategy : public CliActions::BaseStrategy {
 public:
-	int operator()(CliActions::CliAction const& action) const override;
+	int operator()(CliActions::ActionContext const& action) const override;
 	~HelloWorldStrategy() = default;
 };
 
@@ -0,0 +1,235 @@
+// ============================================================================
+//
+// File:        input_streams.hxx
+// Description: Streaming input for the CLI actions. Files (or the standard
+//              input) are consumed as large chunks read through memory
+//              mapping, double buffered `read()' or io_uring, and split into
+//              runs of whole records
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * input_streams.hxx: created.
+// * input_streams.hxx: the carry buffer of a record reader comes from a
+//   memory resource, and a reader can be reused for the next input.
+// * input_streams.hxx: added `RecordReader::reserve'.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// Input Streams Section
+// ============================================================================
+
+namespace InputStreams {
+	constexpr std::size_t DEFAULT_CHUNK_SIZE{1024 * 1024};
+
+	// Reads kept in flight by the io_uring backend (on regular files)
+	constexpr unsigned DEFAULT_QUEUE_DEPTH{4};
+
+	// ------------------------------------------------------------------------
+	// Backend
+	// ------------------------------------------------------------------------
+	//
+	// Description: How the chunks are read.
+	//
+	//              Auto:    Mmap for regular files, Read for anything else.
+	//              Mmap:    the whole file is mapped and read sequentially
+	//                       (`MADV_SEQUENTIAL'), pages already consumed are
+	//                       dropped from the mapping.
+	//              Read:    `read()' into two buffers, a reader thread fills
+	//                       one while the other one is consumed.
+	//              IoUring: reads queued on an io_uring, several of them in
+	//                       flight on regular files (Linux 5.1 and newer).
+	//
+	//              Backends not supported by the input, the platform or the
+	//              kernel fall back to Read.
+	//
+	// ------------------------------------------------------------------------
+	enum class Backend { Auto, Mmap, Read, IoUring };
+
+	char const* backendName(Backend backend);
+
+	// Accepts the names returned by `backendName'
+	bool parseBackend(std::string_view name, Backend& backend);
+
+	// Compiled in, and for io_uring supported by the running kernel
+	bool backendAvailable(Backend backend);
+
+	// ------------------------------------------------------------------------
+	// ChunkSource
+	// ------------------------------------------------------------------------
+	//
+	// Description: Sequence of chunks of an input, in order. A chunk stays
+	//              valid until the next call to `next', so at most a few
+	//              chunks worth of memory is used whatever the input size.
+	//              Chunks split the input at arbitrary positions, see
+	//              `RecordReader' for whole records.
+	//
+	// ------------------------------------------------------------------------
+	class ChunkSource {
+	public:
+		virtual ~ChunkSource() = default;
+
+		ChunkSource(ChunkSource const&) = delete;
+		ChunkSource& operator=(ChunkSource const&) = delete;
+
+		// Returns false at the end of the input or on a read error
+		virtual bool next(std::string_view& chunk) = 0;
+
+		// `errno' value of the read error, zero if none
+		int error() const {
+			return m_Error;
+		}
+
+		// Backend actually reading the input
+		Backend backend() const {
+			return m_Backend;
+		}
+
+	protected:
+		explicit ChunkSource(Backend backend) : m_Backend{backend} { }
+
+		int m_Error{0};
+
+	private:
+		Backend m_Backend;
+	};
+
+	// Chunk source reading from the file descriptor, which is not closed by
+	// the source. Never fails: an unsupported backend falls back to Read,
+	// errors show up on the first `next'.
+	std::unique_ptr<ChunkSource> openChunkSource(
+		int fd,
+		Backend backend = Backend::Auto,
+		std::size_t chunk_size = DEFAULT_CHUNK_SIZE
+	);
+
+	// ------------------------------------------------------------------------
+	// RecordReader
+	// ------------------------------------------------------------------------
+	//
+	// Description: Turns the chunks of a source into runs of whole records.
+	//              Every record of a run ends with the delimiter, except the
+	//              last record of an input not ending with one. A record
+	//              spanning two chunks is copied into a carry buffer and
+	//              handed out on its own, so besides the chunks the reader
+	//              holds at most one record (the longest one) in memory.
+	//              Runs stay valid until the next call to `next'.
+	//
+	//              The carry buffer is taken from `memory', and is kept when
+	//              the reader is reset to read the next input. It grows like
+	//              a vector, so a resource that never frees (a monotonic
+	//              arena) would keep every block it outgrows: give it such a
+	//              resource only with the room reserved for the longest
+	//              record.
+	//
+	// ------------------------------------------------------------------------
+	class RecordReader {
+	public:
+		explicit RecordReader(
+			ChunkSource& source,
+			char delimiter = '\n',
+			std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+		);
+
+		// Returns false at the end of the input or on a read error
+		bool next(std::string_view& records);
+
+		// Reads from the source from now on, dropping what is left of the
+		// previous one
+		void reset(ChunkSource& source);
+
+		// Makes room for carrying a record of `size' bytes, the carry buffer
+		// does not grow for records up to that long
+		void reserve(std::size_t size) {
+			m_Carry.reserve(size);
+		}
+
+		int error() const {
+			return m_Source->error();
+		}
+
+	private:
+		ChunkSource* m_Source;
+		char m_Delimiter;
+		std::string_view m_Pending;  // Rest of the current chunk
+		std::pmr::vector<char> m_Carry;  // Record spanning the chunks
+		bool m_CarryHandedOut;
+	};
+
+	// ------------------------------------------------------------------------
+	// InputFile
+	// ------------------------------------------------------------------------
+	//
+	// Description: File descriptor of an input, opened for reading and
+	//              closed by the destructor. A null path stands for the
+	//              standard input, which is not closed.
+	//
+	// ------------------------------------------------------------------------
+	class InputFile {
+	public:
+		explicit InputFile(char const* path);
+		~InputFile();
+
+		InputFile(InputFile const&) = delete;
+		InputFile& operator=(InputFile const&) = delete;
+
+		bool good() const {
+			return m_Fd >= 0;
+		}
+
+		int fd() const {
+			return m_Fd;
+		}
+
+		// `errno' value of the failed open
+		int error() const {
+			return m_Error;
+		}
+
+	private:
+		int m_Fd;
+		int m_Error;
+		bool m_Owned;
+	};
+};
+
+// End of `input_streams.hxx'
@@ -0,0 +1,292 @@
+// ============================================================================
+//
+// File:        output_sinks.hxx
+// Description: Output sinks the CLI actions write their output to: buffered
+//              gathering file descriptor sink, in-memory sink and memory
+//              mapped file sink
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * output_sinks.hxx: created.
+// * output_sinks.hxx: `FdSink' can write through a caller provided buffer,
+//   the standard sinks do not allocate.
+// * output_sinks.hxx: added `SinkStreamBuffer'.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// ============================================================================
+// Output Sinks Section
+// ============================================================================
+
+namespace OutputSinks {
+	constexpr std::size_t DEFAULT_BUFFER_SIZE{64 * 1024};
+	constexpr std::size_t DEFAULT_MAX_PIECES{64};
+
+	// ------------------------------------------------------------------------
+	// OutputSink
+	// ------------------------------------------------------------------------
+	//
+	// Description: Abstract destination for the output of the CLI actions.
+	//
+	//              `write' copies the data (sinks are free to buffer it),
+	//              `writeStatic' lets the sink keep a reference to the data
+	//              instead. Data passed to `writeStatic' must stay valid until
+	//              the next `flush' (string literals and other constants with
+	//              static storage duration always do).
+	//
+	// ------------------------------------------------------------------------
+	class OutputSink {
+	public:
+		virtual ~OutputSink() = default;
+
+		virtual void write(std::string_view data) = 0;
+
+		virtual void writeStatic(std::string_view data) {
+			write(data);
+		}
+
+		// Pushes buffered data to the destination. Returns false on error.
+		virtual bool flush() = 0;
+
+	protected:
+		OutputSink() = default;
+		OutputSink(OutputSink const&) = default;
+		OutputSink(OutputSink&&) = default;
+		OutputSink& operator=(OutputSink const&) = default;
+		OutputSink& operator=(OutputSink&&) = default;
+	};
+
+	inline OutputSink& operator<<(OutputSink& sink, std::string_view data) {
+		sink.write(data);
+		return sink;
+	}
+
+	inline OutputSink& operator<<(OutputSink& sink, char c) {
+		sink.write(std::string_view{&c, 1});
+		return sink;
+	}
+
+	template <
+		typename Integer,
+		typename = std::enable_if_t<
+			std::is_integral_v<Integer>
+			&& !std::is_same_v<Integer, bool>
+			&& !std::is_same_v<Integer, char>
+		>
+	>
+	OutputSink& operator<<(OutputSink& sink, Integer value) {
+		char digits[24];
+		auto result = std::to_chars(digits, digits + sizeof(digits), value);
+		sink.write(std::string_view{
+			digits,
+			static_cast<std::size_t>(result.ptr - digits)
+		});
+		return sink;
+	}
+
+	// ------------------------------------------------------------------------
+	// FdSink
+	// ------------------------------------------------------------------------
+	//
+	// Description: Sink writing to a file descriptor. Small writes are copied
+	//              into one large buffer, static and large data are referenced
+	//              in place, and all pending pieces go out with a single
+	//              gathered write (`writev') on flush. With `auto_flush' every
+	//              write is flushed at once (stderr semantics).
+	//
+	//              The buffer is allocated by the sink, or provided by the
+	//              caller (it must outlive the sink), in which case the sink
+	//              allocates nothing at all.
+	//
+	// ------------------------------------------------------------------------
+	class FdSink : public OutputSink {
+	public:
+		explicit FdSink(
+			int fd,
+			bool auto_flush = false,
+			std::size_t buffer_size = DEFAULT_BUFFER_SIZE
+		);
+		FdSink(int fd, bool auto_flush, char* buffer, std::size_t buffer_size);
+		~FdSink() override;
+
+		FdSink(FdSink const&) = delete;
+		FdSink& operator=(FdSink const&) = delete;
+
+		void write(std::string_view data) override;
+		void writeStatic(std::string_view data) override;
+		bool flush() override;
+
+		int fd() const {
+			return m_Fd;
+		}
+
+	private:
+		void appendPiece(char const* data, std::size_t size);
+
+		int m_Fd;
+		bool m_AutoFlush;
+		std::unique_ptr<char[]> m_OwnedBuffer;
+		char* m_Buffer;
+		std::size_t m_BufferSize;
+		std::size_t m_Used;
+		std::array<std::string_view, DEFAULT_MAX_PIECES> m_Pieces;
+		std::size_t m_PieceCount;
+		bool m_Error;  // Failed implicit flush, reported by the next flush
+	};
+
+	// ------------------------------------------------------------------------
+	// MemorySink
+	// ------------------------------------------------------------------------
+	//
+	// Description: Sink collecting the output in memory (tests, batch mode).
+	//
+	// ------------------------------------------------------------------------
+	class MemorySink : public OutputSink {
+	public:
+		MemorySink() = default;
+
+		void write(std::string_view data) override {
+			m_Data.append(data.data(), data.size());
+		}
+
+		bool flush() override {
+			return true;
+		}
+
+		std::string_view view() const {
+			return m_Data;
+		}
+
+		// Drops the collected output but keeps the allocated storage
+		void clear() {
+			m_Data.clear();
+		}
+
+	private:
+		std::string m_Data;
+	};
+
+	// ------------------------------------------------------------------------
+	// MappedFileSink
+	// ------------------------------------------------------------------------
+	//
+	// Description: Sink writing into a memory mapped file. The file grows in
+	//              large steps while writing and is truncated to the size of
+	//              the written data on `close'. Writes are plain memory copies,
+	//              the kernel writes the pages back on its own.
+	//
+	// ------------------------------------------------------------------------
+	class MappedFileSink : public OutputSink {
+	public:
+		explicit MappedFileSink(std::string const& path);
+		~MappedFileSink() override;
+
+		MappedFileSink(MappedFileSink const&) = delete;
+		MappedFileSink& operator=(MappedFileSink const&) = delete;
+
+		void write(std::string_view data) override;
+		bool flush() override;
+
+		// Unmaps and truncates the file. Returns false on any error during
+		// the lifetime of the sink.
+		bool close();
+
+		bool good() const {
+			return m_Good;
+		}
+
+	private:
+		bool reserve(std::size_t size);
+
+		int m_Fd;
+		char* m_Map;
+		std::size_t m_Capacity;
+		std::size_t m_Size;
+		bool m_Good;
+	};
+
+	// ------------------------------------------------------------------------
+	// SinkStreamBuffer
+	// ------------------------------------------------------------------------
+	//
+	// Description: Stream buffer forwarding everything inserted into the
+	//              stream to an output sink, for the code that renders into a
+	//              `std::ostream' only (e.g. clipp). It holds no buffer of its
+	//              own, the sinks buffer already.
+	//
+	// ------------------------------------------------------------------------
+	class SinkStreamBuffer : public std::streambuf {
+	public:
+		explicit SinkStreamBuffer(OutputSink& sink) : m_Sink{&sink} { }
+
+	protected:
+		std::streamsize xsputn(char const* data, std::streamsize size) override {
+			m_Sink->write(std::string_view{
+				data,
+				static_cast<std::size_t>(size)
+			});
+			return size;
+		}
+
+		int_type overflow(int_type c) override {
+			if (!traits_type::eq_int_type(c, traits_type::eof())) {
+				*m_Sink << traits_type::to_char_type(c);
+			}
+			return traits_type::not_eof(c);
+		}
+
+	private:
+		OutputSink* m_Sink;
+	};
+
+	// Process-wide sinks for the standard output and the standard error. Both
+	// are buffered: flush the error sink first to keep the diagnostics ahead
+	// of the regular output. Both are flushed at exit as well.
+	OutputSink& standardOutput();
+	OutputSink& standardError();
+};
+
+// End of `output_sinks.hxx'
@@ -0,0 +1,204 @@
+// ============================================================================
+//
+// File:        streaming_input_strategy.hxx
+// Description: Base of the CLI action strategies consuming files (or the
+//              standard input) as large chunks of whole records
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * streaming_input_strategy.hxx: created.
+// * streaming_input_strategy.hxx: added `forEachSource' for the strategies
+//   consuming the raw chunks.
+// * streaming_input_strategy.hxx: one record reader, with its carry buffer
+//   in the arena of the action, reads all the inputs.
+// * streaming_input_strategy.hxx: the carry buffer is reserved for a chunk
+//   on the heap instead of growing in the arena.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "argv_parser.hxx"
+#include "cli_actions.hxx"
+#include "input_streams.hxx"
+#include "tracing.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+// ============================================================================
+// Streaming Input Strategy Section
+// ============================================================================
+
+namespace CliActions {
+	// How the inputs of a strategy are read (see input_streams.hxx)
+	struct InputOptions {
+		std::string_view backend{"auto"};  // Name of the backend
+		std::size_t chunk_size{InputStreams::DEFAULT_CHUNK_SIZE};
+		char delimiter{'\n'};
+	};
+
+	// ------------------------------------------------------------------------
+	// StreamingInputStrategy
+	// ------------------------------------------------------------------------
+	//
+	// Description: Base of the strategies processing input files, the
+	//              standard input when no file is given. Derived strategies
+	//              call `forEachInput' and consume every input as runs of
+	//              whole records, whatever the size of the input the memory
+	//              used stays bounded by a few chunks and the longest record.
+	//              Strategies that do not need whole records call
+	//              `forEachSource' and consume the chunks as they are read,
+	//              then only the chunks are held in memory. The input paths
+	//              are viewed, not copied.
+	//
+	// ------------------------------------------------------------------------
+	class StreamingInputStrategy : public BaseStrategy {
+	public:
+		ArgvParser::ArgSpan inputs() const {
+			return m_Inputs;
+		}
+
+		InputOptions const& inputOptions() const {
+			return m_Options;
+		}
+
+	protected:
+		explicit StreamingInputStrategy(
+			ArgvParser::ArgSpan inputs,
+			InputOptions const& options = InputOptions{}
+		) : m_Inputs{inputs}, m_Options{options}
+		{ }
+
+		// Calls `consume(name, reader)' for each input in turn, with an
+		// `InputStreams::RecordReader' of the input. Inputs that cannot be
+		// read are reported on the error sink, and the remaining ones are
+		// processed still. Returns EXIT_FAILURE if any input failed.
+		//
+		// The same reader is reset for every input, so its carry buffer is
+		// allocated once, with room for a chunk, and then reused. It is not
+		// taken from the arena of the action: a record longer than a chunk
+		// grows it, and the arena would keep every block it outgrows.
+		template <typename Consume>
+		int forEachInput(ActionContext const& action, Consume&& consume) const {
+			std::optional<InputStreams::RecordReader> reader;
+			return forEachSource(
+				action,
+				[this, &consume, &reader](
+					std::string_view name,
+					InputStreams::ChunkSource& source
+				) {
+					if (reader) {
+						reader->reset(source);
+					} else {
+						reader.emplace(source, m_Options.delimiter);
+						reader->reserve(m_Options.chunk_size);
+					}
+					consume(name, *reader);
+				}
+			);
+		}
+
+		// As `forEachInput', with the `InputStreams::ChunkSource' of each
+		// input: `consume(name, source)'
+		template <typename Consume>
+		int forEachSource(ActionContext const& action, Consume&& consume) const {
+			InputStreams::Backend backend;
+			if (!InputStreams::parseBackend(m_Options.backend, backend)) {
+				action.err() << action.execName()
+					<< ": ERROR: unknown input backend '"
+					<< m_Options.backend << "'\n";
+				return EXIT_FAILURE;
+			}
+
+			if (m_Inputs.empty()) {
+				return streamInput(action, nullptr, backend, consume);
+			}
+			int status = EXIT_SUCCESS;
+			for (char const* path : m_Inputs) {
+				if (EXIT_SUCCESS != streamInput(action, path, backend, consume)) {
+					status = EXIT_FAILURE;
+				}
+			}
+			return status;
+		}
+
+	private:
+		template <typename Consume>
+		int streamInput(
+			ActionContext const& action,
+			char const* path,
+			InputStreams::Backend backend,
+			Consume& consume
+		) const {
+			TRACE_SCOPE("streamInput");
+			std::string_view name{nullptr != path ? path : "(standard input)"};
+
+			InputStreams::InputFile file{path};
+			if (!file.good()) {
+				return reportError(action, name, file.error());
+			}
+			auto source = InputStreams::openChunkSource(
+				file.fd(),
+				backend,
+				m_Options.chunk_size
+			);
+			consume(name, *source);
+
+			if (0 != source->error()) {
+				return reportError(action, name, source->error());
+			}
+			return EXIT_SUCCESS;
+		}
+
+		static int reportError(
+			ActionContext const& action,
+			std::string_view name,
+			int error
+		) {
+			action.err() << action.execName() << ": " << name << ": "
+				<< std::strerror(error) << "\n";
+			return EXIT_FAILURE;
+		}
+
+		ArgvParser::ArgSpan m_Inputs;
+		InputOptions m_Options;
+	};
+};
+
+// End of `streaming_input_strategy.hxx'
@@ -0,0 +1,162 @@
+// ============================================================================
+//
+// File:        text_kernels.hxx
+// Description: Text scanning kernels (byte search, delimiter counting, ASCII
+//              case folding and UTF-8 validation) in scalar, SSE2, AVX2 and
+//              AVX-512 variants, the best one supported by the CPU chosen at
+//              runtime
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * text_kernels.hxx: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <cstddef>
+#include <string_view>
+
+// ============================================================================
+// Text Kernels Section
+// ============================================================================
+
+namespace TextKernels {
+	// ------------------------------------------------------------------------
+	// Isa
+	// ------------------------------------------------------------------------
+	//
+	// Description: Instruction set a variant of the kernels is written for.
+	//
+	//              Scalar: portable C++, the reference of the other variants.
+	//              Sse2:   16 bytes at a time (x86-64 baseline).
+	//              Avx2:   32 bytes at a time.
+	//              Avx512: 64 bytes at a time (AVX-512 F and BW).
+	//
+	//              The SIMD variants are compiled in by builds with
+	//              `USE_VECTORIZATION' for x86-64 targets only, each in its
+	//              own translation unit with its own instruction set flags.
+	//              The rest of the program is built for the baseline ISA.
+	//
+	// ------------------------------------------------------------------------
+	enum class Isa { Scalar, Sse2, Avx2, Avx512 };
+
+	constexpr Isa kAllIsas[] = {Isa::Scalar, Isa::Sse2, Isa::Avx2, Isa::Avx512};
+
+	char const* isaName(Isa isa);
+
+	// ------------------------------------------------------------------------
+	// Kernels
+	// ------------------------------------------------------------------------
+	//
+	// Description: One variant of the kernels. All of them take any buffer
+	//              size and alignment, and give the same results as the
+	//              scalar variant.
+	//
+	//              findByte:  index of the first `byte', `size' if none.
+	//              countByte: number of `byte's (e.g. of delimiters).
+	//              foldCase:  copies the text to `out' with the ASCII upper
+	//                         case letters turned to lower case, other bytes
+	//                         as they are. `out' may be `data'.
+	//              validUtf8: the text is well formed UTF-8 (no overlong
+	//                         forms, surrogates or code points past U+10FFFF,
+	//                         no truncated sequences).
+	//
+	// ------------------------------------------------------------------------
+	struct Kernels {
+		Isa isa;
+		std::size_t (*findByte)(char const* data, std::size_t size, char byte);
+		std::size_t (*countByte)(char const* data, std::size_t size, char byte);
+		void (*foldCase)(char const* data, std::size_t size, char* out);
+		bool (*validUtf8)(char const* data, std::size_t size);
+	};
+
+	// Variant for the ISA, null if it is not compiled in or the CPU (and the
+	// operating system) does not support it
+	Kernels const* variant(Isa isa);
+
+	// Best supported variant, chosen on the first call
+	Kernels const& active();
+
+	// ------------------------------------------------------------------------
+	// Dispatching kernels
+	// ------------------------------------------------------------------------
+
+	inline std::size_t findByte(std::string_view text, char byte) {
+		std::size_t index = active().findByte(text.data(), text.size(), byte);
+		return index < text.size() ? index : std::string_view::npos;
+	}
+
+	inline std::size_t countByte(std::string_view text, char byte) {
+		return active().countByte(text.data(), text.size(), byte);
+	}
+
+	// `out' must hold `text.size()' bytes
+	inline void foldCase(std::string_view text, char* out) {
+		active().foldCase(text.data(), text.size(), out);
+	}
+
+	inline bool validUtf8(std::string_view text) {
+		return active().validUtf8(text.data(), text.size());
+	}
+
+	// ------------------------------------------------------------------------
+	// Variant building blocks (text_kernels*.cxx)
+	// ------------------------------------------------------------------------
+	//
+	// Description: Each SIMD variant lives in a translation unit of its own,
+	//              compiled with the flags of its ISA. Those units must not
+	//              use inline functions or templates shared with the rest of
+	//              the program (e.g. from the standard library): the linker
+	//              keeps a single copy of them, which may be the one built
+	//              for a wider ISA than the CPU supports.
+	//
+	// ------------------------------------------------------------------------
+
+	namespace Detail {
+		extern Kernels const kScalarKernels;
+		extern Kernels const kSse2Kernels;
+		extern Kernels const kAvx2Kernels;
+		extern Kernels const kAvx512Kernels;
+
+		// Length of the UTF-8 sequence at the start of the text, zero if it
+		// is malformed or truncated. The text must not be empty.
+		std::size_t utf8SequenceLength(
+			unsigned char const* text,
+			std::size_t size
+		);
+	};
+};
+
+// End of `text_kernels.hxx'
@@ -0,0 +1,238 @@
+// ============================================================================
+//
+// File:        tracing.hxx
+// Description: Low-overhead phase tracing. Scoped timers record into per-thread
+//              ring buffers, collected at exit into a Chrome `trace_event'
+//              JSON file and a summary table
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * tracing.hxx: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "common.hxx"
+#include "output_sinks.hxx"
+
+// Standard library headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Tracing Section
+// ============================================================================
+
+namespace Tracing {
+	// Events kept per thread, older ones are overwritten (power of two)
+	constexpr std::size_t DEFAULT_RING_CAPACITY{4096};
+
+#if defined(USE_TRACING)
+	constexpr bool kCompiledIn{true};
+#else
+	constexpr bool kCompiledIn{false};
+#endif
+
+	// Nanoseconds since the tracing epoch, taken during the static
+	// initialization of the program (as early as the toolchain allows)
+	using Timestamp = std::uint64_t;
+
+	// Complete event (a span of time with a name)
+	struct Event {
+		char const* name;  // Must have static storage duration
+		Timestamp start;
+		Timestamp duration;
+	};
+
+	// Event together with the (small, sequential) id of its thread
+	struct CollectedEvent {
+		Event event;
+		std::uint32_t thread;
+	};
+
+	namespace Detail {
+		inline std::atomic<bool> g_Enabled{false};
+	};
+
+	// The only cost of a disabled trace point: one relaxed load and a branch
+	inline bool enabled() {
+		return Detail::g_Enabled.load(std::memory_order_relaxed);
+	}
+
+	void setEnabled(bool enabled);
+
+	Timestamp now();
+
+	// Appends the event to the ring buffer of the calling thread. Lock-free,
+	// the ring is registered (under a lock) only on the first event of the
+	// thread.
+	void record(char const* name, Timestamp start, Timestamp end);
+
+	// Returns the events of all threads ordered by start time, and the number
+	// of events overwritten in the rings. Threads must not record meanwhile.
+	std::vector<CollectedEvent> collect(std::size_t* dropped = nullptr);
+
+	// Empties all rings. Threads must not record meanwhile.
+	void reset();
+
+	// Chrome `trace_event' JSON (load in chrome://tracing or Perfetto)
+	void writeChromeTrace(
+		OutputSinks::OutputSink& sink,
+		std::vector<CollectedEvent> const& events,
+		std::size_t dropped = 0
+	);
+
+	// Count, total, mean and maximum duration per event name
+	void writeSummary(
+		OutputSinks::OutputSink& sink,
+		std::vector<CollectedEvent> const& events,
+		std::size_t dropped = 0
+	);
+
+	// Removes every `--trace=FILE' argument from the argument vector and
+	// returns the last FILE. Without one returns the value of the `env_var'
+	// environment variable (if set), otherwise an empty string.
+	std::string traceFileFromCommandLine(
+		int& argc,
+		char** argv,
+		char const* env_var
+	);
+
+	// ------------------------------------------------------------------------
+	// ScopedTimer
+	// ------------------------------------------------------------------------
+	//
+	// Description: Records the lifetime of the object as an event, if the
+	//              tracing was enabled when it was created. Use through the
+	//              `TRACE_SCOPE' macro, which compiles to nothing in builds
+	//              without `USE_TRACING'.
+	//
+	// ------------------------------------------------------------------------
+	class ScopedTimer {
+	public:
+		explicit ScopedTimer(char const* name)
+			: m_Name{name},
+			m_Start{enabled() ? now() : kInactive}
+		{ }
+
+		~ScopedTimer() {
+			if (m_Start != kInactive) {
+				record(m_Name, m_Start, now());
+			}
+		}
+
+		ScopedTimer(ScopedTimer const&) = delete;
+		ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+	private:
+		static constexpr Timestamp kInactive{
+			std::numeric_limits<Timestamp>::max()
+		};
+
+		char const* m_Name;
+		Timestamp m_Start;
+	};
+
+	// ------------------------------------------------------------------------
+	// Session
+	// ------------------------------------------------------------------------
+	//
+	// Description: Enables the tracing for its lifetime. When finished, writes
+	//              the collected events to the trace file and the summary
+	//              table to the given sink.
+	//
+	// ------------------------------------------------------------------------
+	class Session {
+	public:
+		Session() = default;
+		~Session();
+
+		Session(Session const&) = delete;
+		Session& operator=(Session const&) = delete;
+
+		// Fails if the tracing is not compiled in
+		bool start(
+			std::string trace_file,
+			OutputSinks::OutputSink& summary = OutputSinks::standardError()
+		);
+
+		// Stops the tracing and writes the results. Returns false if the
+		// trace file could not be written.
+		bool finish();
+
+		bool active() const {
+			return m_Summary != nullptr;
+		}
+
+	private:
+		std::string m_TraceFile;
+		OutputSinks::OutputSink* m_Summary{nullptr};
+	};
+
+};
+
+// ============================================================================
+// Trace Points Section
+// ============================================================================
+
+#define TRACING_CONCAT_IMPL(a, b) a##b
+#define TRACING_CONCAT(a, b) TRACING_CONCAT_IMPL(a, b)
+
+#if defined(USE_TRACING)
+
+// Records the rest of the enclosing scope under the given name
+#define TRACE_SCOPE(name) \
+	::Tracing::ScopedTimer TRACING_CONCAT(traceScope_, __LINE__){name}
+
+// Records the time from the tracing epoch until now under the given name
+#define TRACE_SINCE_START(name) \
+	do { \
+		if (::Tracing::enabled()) { \
+			::Tracing::record(name, 0, ::Tracing::now()); \
+		} \
+	} while (false)
+
+#else
+
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#define TRACE_SINCE_START(name) static_cast<void>(0)
+
+#endif
+
+// End of `tracing.hxx'
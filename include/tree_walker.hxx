@@ -0,0 +1,149 @@
+// ============================================================================
+//
+// File:        tree_walker.hxx
+// Description: Parallel directory tree traversal. Directories are spread
+//              over a pool of worker threads that steal work from each
+//              other, the files are handed to a pluggable visitor with one
+//              instance per thread
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * tree_walker.hxx: created.
+// * tree_walker.hxx: added `maxJobs', the number of jobs is bounded.
+// * tree_walker.hxx: documented the threads the visitors are called on.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "argv_parser.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+// ============================================================================
+// Tree Walker Section
+// ============================================================================
+
+namespace TreeWalker {
+	// ------------------------------------------------------------------------
+	// FileVisitor
+	// ------------------------------------------------------------------------
+	//
+	// Description: Per-file work of a walk. Every worker thread visits the
+	//              files it finds with a visitor of its own, forked from the
+	//              one given to `walk' on the calling thread before the
+	//              workers start, so visitors accumulate their results
+	//              without any locking. Once the workers are done the forks
+	//              are merged into the given visitor, in the order of the
+	//              workers, on the calling thread.
+	//
+	//              Visitors must not throw.
+	//
+	// ------------------------------------------------------------------------
+	class FileVisitor {
+	public:
+		virtual ~FileVisitor() = default;
+
+		// New visitor for a worker, with no results of its own
+		virtual std::unique_ptr<FileVisitor> fork() const = 0;
+
+		// Called for every entry that is not a directory (symbolic links
+		// to directories included, they are not followed)
+		virtual void visit(std::filesystem::directory_entry const& entry) = 0;
+
+		// Adds the results of a fork of this visitor
+		virtual void merge(FileVisitor& fork) = 0;
+
+	protected:
+		FileVisitor() = default;
+		FileVisitor(FileVisitor const&) = default;
+		FileVisitor& operator=(FileVisitor const&) = default;
+	};
+
+	// Directory or root that could not be read
+	struct WalkError {
+		std::filesystem::path path;
+		std::error_code error;
+	};
+
+	// Totals of a walk
+	struct WalkStats {
+		std::size_t directories{0};
+		std::size_t files{0};
+		std::vector<WalkError> errors;
+	};
+
+	// Worker threads to use when none are asked for, at least one
+	unsigned defaultJobs();
+
+	// Most worker threads a walk runs on, a small multiple of
+	// `defaultJobs()'
+	unsigned maxJobs();
+
+	// ------------------------------------------------------------------------
+	// walk
+	// ------------------------------------------------------------------------
+	//
+	// Description: Visits the files under the roots on `jobs' threads (the
+	//              calling thread is one of them), `defaultJobs()' if zero
+	//              and `maxJobs()' at most. If the system refuses to start
+	//              more threads the walk goes on with those started. A root
+	//              that is not a directory is visited as a file.
+	//
+	//              Each worker owns a queue of directories to read. It adds
+	//              the subdirectories it finds to the back of its own queue
+	//              and takes the next directory from the back as well
+	//              (depth first, warm caches), and when its queue runs dry it
+	//              steals from the front of the queue of another worker,
+	//              where the oldest and usually the largest subtrees are.
+	//              Queues are locked one at a time and once per directory,
+	//              files take no lock at all.
+	//
+	//              The order the files are visited in is not deterministic,
+	//              visitors sort their results when they need to.
+	//
+	// ------------------------------------------------------------------------
+	WalkStats walk(
+		ArgvParser::ArgSpan roots,
+		FileVisitor& visitor,
+		unsigned jobs = 0
+	);
+};
+
+// End of `tree_walker.hxx'
@@ -0,0 +1,84 @@
+// ============================================================================
+//
+// File:        walk_strategy.hxx
+// Description: Strategy listing the files under its directory arguments,
+//              walked on a pool of worker threads
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * walk_strategy.hxx: created.
+// * walk_strategy.hxx: documented the limit of the jobs.
+// * walk_strategy.hxx: documented the streamed listing.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project headers
+#include "argv_parser.hxx"
+#include "cli_actions.hxx"
+
+// Standard library headers
+#include <string_view>
+
+// ============================================================================
+// Strategy Declaration Section
+// ============================================================================
+
+// Prints the size in bytes and the path of every file under the roots (the
+// current directory if none is given), followed by the total size. The
+// roots are walked on `jobs' threads (the number of CPUs if empty, see
+// tree_walker.hxx). Unless `sorted', the files are listed as they are found,
+// every worker writing out its lines a buffer at a time, so the listing
+// takes little memory however many files there are. Sorted files are listed
+// by path once the walk is over. Fails if a root or a directory could not be
+// read, or if `jobs' is not a number from one to `TreeWalker::maxJobs()'.
+class WalkStrategy : public CliActions::BaseStrategy {
+public:
+	explicit WalkStrategy(
+		ArgvParser::ArgSpan roots,
+		std::string_view const& jobs = {},
+		bool sorted = false
+	) : m_Roots{roots}, m_Jobs{jobs}, m_Sorted{sorted}
+	{ }
+
+	int operator()(CliActions::ActionContext const& action) const override;
+
+private:
+	ArgvParser::ArgSpan m_Roots;
+	std::string_view m_Jobs;
+	bool m_Sorted;
+};
+
+// End of `walk_strategy.hxx'
@@ -0,0 +1,356 @@
+// ============================================================================
+//
+// File:        batch_server.cxx
+// Description: Batch mode request reader, reply framing and socket server
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * batch_server.cxx: created.
+// * batch_server.cxx: replies are collected in memory sinks and written with
+//   an `FdSink'.
+// * batch_server.cxx: empty requests are skipped instead of dispatched with
+//   no arguments.
+// * batch_server.cxx: `serveUnixSocket' reports its errors to an error sink
+//   instead of `std::cerr'.
+// * batch_server.cxx: a read error is reported and fails `serveStream'
+//   instead of passing for the end of the requests.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "batch_server.hxx"
+
+// Standard library headers
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+
+// System headers
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+
+// ============================================================================
+// Local Helpers Section
+// ============================================================================
+
+namespace {
+
+    // Reads at most `size' bytes, retrying on signal interruption. Returns
+    // the number of bytes read, zero on end of stream or -1 on error.
+    long readSome(int fd, char* data, std::size_t size)
+    {
+        for (;;) {
+#if defined(_WIN32)
+            long n = _read(fd, data, static_cast<unsigned>(size));
+#else
+            long n = static_cast<long>(::read(fd, data, size));
+#endif
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            return n;
+        }
+    }
+
+    // Splits a line into blank separated fields
+    void splitFields(std::string_view line, BatchServer::ArgList& args)
+    {
+        std::size_t pos = 0;
+        while (pos < line.size()) {
+            std::size_t begin = line.find_first_not_of(" \t", pos);
+            if (begin == std::string_view::npos) {
+                break;
+            }
+            std::size_t end = line.find_first_of(" \t", begin);
+            if (end == std::string_view::npos) {
+                end = line.size();
+            }
+            args.emplace_back(line.substr(begin, end - begin));
+            pos = end;
+        }
+    }
+
+};
+
+
+// ============================================================================
+// RequestReader Definition Section
+// ============================================================================
+
+BatchServer::RequestReader::RequestReader(
+    int fd,
+    RecordFormat format,
+    std::size_t buffer_size
+) : m_Fd{fd},
+    m_Format{format},
+    m_Buffer(buffer_size > 0 ? buffer_size : DEFAULT_READ_BUFFER_SIZE),
+    m_Begin{0},
+    m_End{0},
+    m_Eof{false},
+    m_Error{0}
+{ }
+
+bool
+BatchServer::RequestReader::next(ArgList& args)
+{
+    args.clear();
+    std::string_view record;
+
+    if (m_Format == RecordFormat::Lines) {
+        while (args.empty()) {
+            if (!nextRecord(record, '\n')) {
+                return false;
+            }
+            if (!record.empty() && record.back() == '\r') {
+                record.remove_suffix(1);
+            }
+            splitFields(record, args);
+        }
+
+        return true;
+    }
+
+    while (nextRecord(record, '\0')) {
+        if (record.empty()) {
+            // Empty argument terminates the request
+            if (!args.empty()) {
+                return true;
+            }
+            continue;
+        }
+        args.emplace_back(record);
+    }
+
+    // Dispatch an unterminated trailing request as well
+    return !args.empty() && 0 == m_Error;
+}
+
+bool
+BatchServer::RequestReader::nextRecord(
+    std::string_view& record,
+    char delimiter
+) {
+    for (;;) {
+        char* begin = m_Buffer.data() + m_Begin;
+        std::size_t available = m_End - m_Begin;
+
+        void* hit = std::memchr(begin, delimiter, available);
+        if (hit != nullptr) {
+            std::size_t length = static_cast<char*>(hit) - begin;
+            record = std::string_view{begin, length};
+            m_Begin += length + 1;
+            return true;
+        }
+
+        if (m_Eof) {
+            if (available == 0) {
+                return false;
+            }
+            record = std::string_view{begin, available};
+            m_Begin = m_End;
+            return true;
+        }
+
+        // Move the partial record to the front and make room for more data
+        if (m_Begin > 0) {
+            std::memmove(m_Buffer.data(), begin, available);
+            m_Begin = 0;
+            m_End = available;
+        }
+        if (m_End == m_Buffer.size()) {
+            m_Buffer.resize(m_Buffer.size() * 2);
+        }
+
+        long n = readSome(m_Fd, m_Buffer.data() + m_End, m_Buffer.size() - m_End);
+        if (n < 0) {
+            // The partial record is dropped
+            m_Error = errno;
+            m_Eof = true;
+            m_Begin = m_End;
+            return false;
+        }
+        if (n == 0) {
+            m_Eof = true;
+        } else {
+            m_End += static_cast<std::size_t>(n);
+        }
+    }
+}
+
+
+// ============================================================================
+// Server Loops Definition Section
+// ============================================================================
+
+int
+BatchServer::serveStream(
+    int in_fd,
+    int out_fd,
+    RecordFormat format,
+    RequestHandler const& handler,
+    OutputSinks::OutputSink& err
+) {
+    RequestReader reader{in_fd, format};
+    ArgList args;
+
+    // Reused for all the requests, so they only allocate while growing
+    OutputSinks::MemorySink requestOut;
+    OutputSinks::MemorySink requestErr;
+    OutputSinks::FdSink reply{out_fd};
+
+#if !defined(_WIN32)
+    // A client going away must not kill the server
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+    while (reader.next(args)) {
+        int status = EXIT_FAILURE;
+        requestOut.clear();
+        requestErr.clear();
+
+        try {
+            status = handler(args, requestOut, requestErr);
+        } catch (std::exception const& e) {
+            requestErr << "ERROR: " << e.what() << "\n";
+        } catch (...) {
+            requestErr << "ERROR: unknown exception\n";
+        }
+
+        // Header and both payloads go out with a single gathered write, the
+        // payloads are not copied
+        reply << status << ' '
+            << requestOut.view().size() << ' '
+            << requestErr.view().size() << '\n';
+        reply.writeStatic(requestOut.view());
+        reply.writeStatic(requestErr.view());
+        if (!reply.flush()) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != reader.error()) {
+        err << "ERROR: cannot read the requests: "
+            << std::strerror(reader.error()) << "\n";
+        err.flush();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int
+BatchServer::serveUnixSocket(
+    std::string const& path,
+    RecordFormat format,
+    RequestHandler const& handler,
+    OutputSinks::OutputSink& err
+) {
+#if defined(_WIN32)
+    (void)format;
+    (void)handler;
+    err << "ERROR: Unix domain sockets are not supported on this "
+        "platform (" << path << ")\n";
+    err.flush();
+
+    return EXIT_FAILURE;
+#else
+    // Reports a failed system call with the message of `errno'
+    auto systemError = [&err](std::string_view what) {
+        err << "ERROR: " << what << ": " << std::strerror(errno) << "\n";
+        err.flush();
+    };
+
+    struct sockaddr_un address {};
+    if (path.size() >= sizeof(address.sun_path)) {
+        err << "ERROR: socket path too long: " << path << "\n";
+        err.flush();
+        return EXIT_FAILURE;
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    // Remove a stale socket left behind by a previous server, but never
+    // touch anything that is not a socket
+    struct stat info {};
+    if (::stat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+        ::unlink(path.c_str());
+    }
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        systemError("socket");
+        return EXIT_FAILURE;
+    }
+    if (::bind(listener,
+            reinterpret_cast<struct sockaddr*>(&address),
+            sizeof(address)) < 0
+        || ::listen(listener, SOMAXCONN) < 0
+    ) {
+        systemError(path);
+        ::close(listener);
+        return EXIT_FAILURE;
+    }
+
+    for (;;) {
+        int client = ::accept(listener, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            systemError("accept");
+            break;
+        }
+
+        // A failed read or reply only ends the session with that client
+        serveStream(client, client, format, handler, err);
+        ::close(client);
+    }
+
+    ::close(listener);
+    ::unlink(path.c_str());
+
+    return EXIT_FAILURE;
+#endif
+}
+
+// End of `batch_server.cxx'
@@ -33,6 +33,45 @@
 //
 // * cli_template_app.cpp: created.
 //
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * cli_template_app.cpp: moved action selection into `dispatchAction' so it
+//   can be reused by the batch mode (`--serve'), and fixed the default action
+//   overriding the selected one.
+// * cli_template_app.cpp: actions are selected into a `StaticCliAction'
+//   instead of a heap allocated `CliAction'.
+// * cli_template_app.cpp: help, usage and version texts are pre-rendered at
+//   build time.
+// * cli_template_app.cpp: actions write to output sinks, batch mode requests
+//   to in-memory ones.
+// * cli_template_app.cpp: program phases are traced when `--trace=FILE' is
+//   given.
+// * cli_template_app.cpp: options are parsed by the allocation-free
+//   `kOptionTable' instead of clipp, the exec name is a view into `argv[0]'.
+// * cli_template_app.cpp: a memory arena on the stack of `main' is handed to
+//   the actions, batch mode requests take their scratch memory from it and
+//   release it after each request.
+// * cli_template_app.cpp: added the `--grep' streaming input action over the
+//   input files.
+// * cli_template_app.cpp: added the `--count' input action.
+// * cli_template_app.cpp: added the `--walk' directory walk action.
+// * cli_template_app.cpp: a value option given without its value is
+//   reported, in batch mode requests as well.
+// * cli_template_app.cpp: the arena is released before each request rather
+//   than after it, also when the previous request threw.
+// * cli_template_app.cpp: a missing argument is shown with the usage text
+//   rendered at build time.
+// * cli_template_app.cpp: batch mode refuses any option other than the batch
+//   mode options, and any input file.
+// * cli_template_app.cpp: errors reading the requests from the standard input
+//   are reported to the standard error.
+// * cli_template_app.cpp: a missing value is reported before the input files
+//   left without an input action (an empty value is one of them).
+// * cli_template_app.cpp: `--jobs' and `--sort' without `--walk' are
+//   reported as unsupported instead of ignored.
+// * cli_template_app.cpp: `--input-backend' without `--grep' or `--count' is
+//   reported as unsupported instead of ignored.
+//
 // ============================================================================
 
 
@@ -41,94 +80,546 @@
 // ============================================================================
 
 // Project library headers
+#include "action_registry.hxx"
+#include "batch_server.hxx"
 #include "cli_actions.hxx"
 #include "cli_template_app.hxx"
+#include "count_strategy.hxx"
+#include "grep_strategy.hxx"
 #include "hello_world_strategy.hxx"
+#include "help_text.hxx"  // Generated at build time
+#include "output_sinks.hxx"
+#include "streaming_input_strategy.hxx"
+#include "tracing.hxx"
+#include "walk_strategy.hxx"
 
 // Standard library headers
+#include <array>
+#include <cstddef>
 #include <cstdlib>
-#include <iostream>
-#include <string>
-#include <memory>
-#include <filesystem>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
 
-int main(int argc, char** argv)
-{    
-    namespace fs = std::filesystem;  // Define a shorter alias for filesystem
-    using Action = CliActions::CliAction;
-    using ActionPointer = std::unique_ptr<Action>;
+// ============================================================================
+// Action Dispatch Section
+// ============================================================================
 
-    // Determine the exec name under wich program is beeing executed
-    std::string execName = fs::path(argv[0]).filename().string();
+// Closed set of actions the program can execute. Order of the strategies
+// is irrelevant, the selection is done by type.
+using ProgramAction = CliActions::StaticCliAction<
+    CliActions::UnsupportedOptionsStrategyClipp,
+    CliActions::ShowHelpStrategyClipp,
+    CliActions::ShowUsageStrategyClipp,
+    CliActions::ShowVersionInfoStrategy,
+    CliActions::ShowStaticTextStrategy,
+    CliActions::MissingArgumentStrategyClipp,
+    CliActions::MissingArgumentStrategy,
+    CountStrategy,
+    GrepStrategy,
+    HelloWorldStrategy,
+    WalkStrategy
+>;
+
+// How the input actions read their inputs
+static CliActions::InputOptions inputOptions(CliOptionViews const& options)
+{
+    CliActions::InputOptions input;
+    if (!options.m_InputBackend.empty())
+    {
+        input.backend = options.m_InputBackend;
+    }
+
+    return input;
+}
+
+// An action reading the standard input when no input file is named is
+// requested
+static bool streamingInputAction(CliOptionViews const& options)
+{
+    return !options.m_GrepPattern.empty() || options.m_Count;
+}
+
+// An action consuming the input files (or the standard input) is requested
+static bool inputAction(CliOptionViews const& options)
+{
+    return streamingInputAction(options) || options.m_Walk;
+}
+
+// Options of the walk action given without `--walk', as a view of their
+// names (empty if there are none)
+static ArgvParser::ArgSpan strayWalkOptions(CliOptionViews const& options)
+{
+    static constexpr char const* kNames[] = {"--jobs", "--sort"};
 
-    // Parse command line options
-    auto result = clipp::parse(argc, argv, appOptions);
+    if (options.m_Walk)
+    {
+        return ArgvParser::ArgSpan{};
+    }
+    bool const jobs = !options.m_Jobs.empty();
+    std::size_t const size = (jobs ? 1 : 0) + (options.m_Sort ? 1 : 0);
+
+    return ArgvParser::ArgSpan{jobs ? kNames : kNames + 1, size};
+}
+
+// `--input-backend' given without an action reading the inputs, as a view
+// of its name (empty if it is not)
+static ArgvParser::ArgSpan strayInputOptions(CliOptionViews const& options)
+{
+    static constexpr char const* kNames[] = {"--input-backend"};
+
+    if (options.m_InputBackend.empty() || streamingInputAction(options))
+    {
+        return ArgvParser::ArgSpan{};
+    }
+
+    return ArgvParser::ArgSpan{kNames, 1};
+}
+
+// Nothing but the batch mode options is given
+static bool batchOptionsOnly(CliOptionViews const& options)
+{
+    return !options.m_ShowHelp
+        && !options.m_PrintUsage
+        && !options.m_ShowVersion
+        && options.m_Inputs.empty()
+        && options.m_GrepPattern.empty()
+        && !options.m_Count
+        && !options.m_Walk
+        && options.m_Jobs.empty()
+        && !options.m_Sort
+        && options.m_InputBackend.empty();
+}
+
+// Error message on a value option given as the last argument, built in the
+// arena so it lives as long as the action does
+static std::string_view missingValueMessage(
+    std::string_view option,
+    std::pmr::memory_resource& arena
+) {
+    constexpr std::string_view kPrefix = "option '";
+    constexpr std::string_view kSuffix = "' requires an argument";
+
+    std::size_t const size = kPrefix.size() + option.size() + kSuffix.size();
+    char* message = static_cast<char*>(arena.allocate(size, 1));
+    kPrefix.copy(message, kPrefix.size());
+    option.copy(message + kPrefix.size(), option.size());
+    kSuffix.copy(message + kPrefix.size() + option.size(), kSuffix.size());
+
+    return std::string_view{message, size};
+}
 
-    // Reference to a program action that will be executed
-    ActionPointer programAction;
+// Selects the program action from the parsed option values. The action is
+// returned by value and built in place, nothing is allocated for it.
+// Documentation texts rendered at build time are used whenever the program
+// runs under its own name, since the exec name is a part of those texts.
+static ProgramAction selectAction(
+    std::string_view execName,
+    CliOptionViews const& options,
+    ArgvParser::ParseResult const& parsed,
+    OutputSinks::OutputSink& out,
+    OutputSinks::OutputSink& err,
+    std::pmr::memory_resource& arena
+) {
+    TRACE_SCOPE("selectAction");
 
     // Check for the unsupported options --------------------------------------
-    if (!userOptionValues.m_Unsupported.empty())
+    if (!options.m_Unsupported.empty())
     {
-        programAction
-            = std::make_unique<CliActions::CliAction> (
+        return ProgramAction (
+            execName,
+            CliActions::UnsupportedOptionsStrategyClipp(
+                options.m_Unsupported
+            ),
+            out,
+            err,
+            arena
+        );
+    }
+
+    // Check for a value option without its value -----------------------------
+    if (!parsed)
+    {
+        if (execName == PrerenderedText::kExecName)
+        {
+            return ProgramAction (
                 execName,
-                CliActions::UnsupportedOptionsStrategyClipp(
-                    userOptionValues.m_Unsupported
-                )
+                CliActions::MissingArgumentStrategy(
+                    missingValueMessage(parsed.missing_value, arena),
+                    PrerenderedText::kMissingArgumentUsage
+                ),
+                out,
+                err,
+                arena
             );
+        }
+        return ProgramAction (
+            execName,
+            CliActions::MissingArgumentStrategyClipp(
+                missingValueMessage(parsed.missing_value, arena),
+                appOptions(),
+                CliActions::pageFormatting()
+            ),
+            out,
+            err,
+            arena
+        );
+    }
+
+    // Input files are consumed by the input actions only
+    if (!options.m_Inputs.empty() && !inputAction(options))
+    {
+        return ProgramAction (
+            execName,
+            CliActions::UnsupportedOptionsStrategyClipp(options.m_Inputs),
+            out,
+            err,
+            arena
+        );
+    }
+
+    // Options of the walk action are not taken by any other action
+    ArgvParser::ArgSpan const strayWalk = strayWalkOptions(options);
+    if (!strayWalk.empty())
+    {
+        return ProgramAction (
+            execName,
+            CliActions::UnsupportedOptionsStrategyClipp(strayWalk),
+            out,
+            err,
+            arena
+        );
+    }
+
+    // The input backend is used by the streaming input actions only
+    ArgvParser::ArgSpan const strayInput = strayInputOptions(options);
+    if (!strayInput.empty())
+    {
+        return ProgramAction (
+            execName,
+            CliActions::UnsupportedOptionsStrategyClipp(strayInput),
+            out,
+            err,
+            arena
+        );
     }
 
     // Check for high priority switches ---------------------------------------
     // (i.e. '--help', '--usage', '--version')
-    else if (userOptionValues.m_ShowHelp)
+    if (options.m_ShowHelp)
     {
         // Check if the help switch was triggered. We give help switch the
         // highest priority, so if it is triggered we don't need to check
         // anything else.
-        programAction = std::make_unique<Action> (
+        if (execName == PrerenderedText::kExecName)
+        {
+            return ProgramAction (
+                execName,
+                CliActions::ShowStaticTextStrategy(PrerenderedText::kHelp),
+                out,
+                err,
+                arena
+            );
+        }
+        return ProgramAction (
             execName,
-            CliActions::ShowHelpStrategyClipp(
-                appOptions,
-                kAppDoc,
-                kAuthorEmail
-            )
+            makeShowHelpStrategy(),
+            out,
+            err,
+            arena
         );
     }
-    else if (userOptionValues.m_PrintUsage)
+    if (options.m_PrintUsage)
     {
         // Check if the usage switch was triggered. Usge switch has the second
         // highest priority, so if it is triggered we don't need to check
         // anything else.
-        auto fmt = clipp::doc_formatting {}
-            .first_column(CliActions::DEFAULT_PAGE_IDENT)
-            .last_column(CliActions::DEFAULT_PAGE_WIDTH);
-        programAction = std::make_unique<Action> (
+        if (execName == PrerenderedText::kExecName)
+        {
+            return ProgramAction (
+                execName,
+                CliActions::ShowStaticTextStrategy(PrerenderedText::kUsage),
+                out,
+                err,
+                arena
+            );
+        }
+        return ProgramAction (
             execName,
-            CliActions::ShowUsageStrategyClipp(appOptions, fmt)
+            makeShowUsageStrategy(),
+            out,
+            err,
+            arena
         );
     }
-    else if (userOptionValues.m_ShowVersion)
+    if (options.m_ShowVersion)
     {
         // Check if the version switch was triggered. Version switch has the
         // third highest priority.
-        programAction = std::make_unique<Action> (
+        if (execName == PrerenderedText::kExecName)
+        {
+            return ProgramAction (
+                execName,
+                CliActions::ShowStaticTextStrategy(PrerenderedText::kVersion),
+                out,
+                err,
+                arena
+            );
+        }
+        return ProgramAction (
+            execName,
+            makeShowVersionStrategy(),
+            out,
+            err,
+            arena
+        );
+    }
+
+    // Check for the input actions ---------------------------------------------
+    if (!options.m_GrepPattern.empty())
+    {
+        return ProgramAction (
+            execName,
+            GrepStrategy(
+                options.m_GrepPattern,
+                options.m_Inputs,
+                inputOptions(options)
+            ),
+            out,
+            err,
+            arena
+        );
+    }
+    if (options.m_Count)
+    {
+        return ProgramAction (
+            execName,
+            CountStrategy(options.m_Inputs, inputOptions(options)),
+            out,
+            err,
+            arena
+        );
+    }
+    if (options.m_Walk)
+    {
+        return ProgramAction (
             execName,
-            CliActions::ShowVersionInfoStrategy (
-                kVersionString,
-                kYearString,
-                kCopyrightHolder,
-                kLicense
-            )
+            WalkStrategy(options.m_Inputs, options.m_Jobs, options.m_Sort),
+            out,
+            err,
+            arena
         );
     }
+
     // No high priority switch was passed. Proceed with normal execution
-    programAction = std::make_unique<Action> (
+    return ProgramAction (
         execName,
-        HelloWorldStrategy()
+        HelloWorldStrategy(),
+        out,
+        err,
+        arena
     );
+}
+
+// Selects the program action from the parsed option values, executes it and
+// flushes its output. Diagnostics are flushed ahead of the regular output.
+static int dispatchAction(
+    std::string_view execName,
+    CliOptionViews const& options,
+    ArgvParser::ParseResult const& parsed,
+    OutputSinks::OutputSink& out,
+    OutputSinks::OutputSink& err,
+    std::pmr::memory_resource& arena
+) {
+    int status = selectAction(
+        execName,
+        options,
+        parsed,
+        out,
+        err,
+        arena
+    ).execute();
+
+    TRACE_SCOPE("flush");
+    err.flush();
+    if (!out.flush() && status == EXIT_SUCCESS)
+    {
+        status = EXIT_FAILURE;
+    }
+
+    return status;
+}
+
+// Parses and executes a single batch mode request. The argument vector is
+// built in the arena, which the caller releases before the next request.
+static int serveRequest(
+    std::string_view execName,
+    BatchServer::ArgList const& args,
+    std::pmr::memory_resource& arena,
+    OutputSinks::OutputSink& out,
+    OutputSinks::OutputSink& err
+) {
+    TRACE_SCOPE("serveRequest");
+
+    std::pmr::vector<char const*> argv{&arena};
+    argv.reserve(args.size() + 1);
+    argv.push_back(nullptr);  // In place of the program name
+    for (auto const& arg : args) {
+        argv.push_back(arg.c_str());
+    }
+
+    CliOptionViews options{kDefaultOptionViews};
+    ArgvParser::ParseResult parsed;
+    {
+        TRACE_SCOPE("parse");
+        parsed = kOptionTable.parse(
+            static_cast<int>(argv.size()),
+            argv.data(),
+            options
+        );
+    }
+
+    // Batch mode options make no sense inside of a request
+    if (options.m_Serve
+        || options.m_ServeNullDelimited
+        || !options.m_ServeSocket.empty()
+    ) {
+        err << execName
+            << ": ERROR: batch mode options are not allowed in requests\n";
+        return EXIT_FAILURE;
+    }
 
-    return programAction->execute();
+    // The standard input carries the requests
+    if (parsed
+        && streamingInputAction(options)
+        && options.m_Inputs.empty()
+    )
+    {
+        err << execName
+            << ": ERROR: requests must name their input files\n";
+        return EXIT_FAILURE;
+    }
+
+    return dispatchAction(execName, options, parsed, out, err, arena);
+}
+
+// Name the program was executed under (file name part of `argv[0]')
+static std::string_view executableName(char const* argv0)
+{
+    std::string_view path{argv0 != nullptr ? argv0 : ""};
+#if defined(_WIN32)
+    auto separator = path.find_last_of("/\\");
+#else
+    auto separator = path.find_last_of('/');
+#endif
+    if (separator != std::string_view::npos)
+    {
+        path.remove_prefix(separator + 1);
+    }
+
+    return path;
+}
+
+
+// ============================================================================
+// Main Function Section
+// ============================================================================
+
+int main(int argc, char** argv)
+{
+    // Set up the tracing first, so it covers the option parsing as well. The
+    // session outlives every trace point below and writes the trace when
+    // `main' returns.
+    Tracing::Session traceSession;
+    std::string traceFile = Tracing::traceFileFromCommandLine(
+        argc,
+        argv,
+        kTraceEnvVar
+    );
+    if (!traceFile.empty() && !traceSession.start(traceFile))
+    {
+        OutputSinks::standardError() << kAppName
+            << ": WARNING: tracing support is not compiled in\n";
+    }
+    TRACE_SINCE_START("static initialization");
+    TRACE_SCOPE("main");
+
+    // Memory of the strategies, released all at once. It lives as long as
+    // `main' does, so everything taken from it may be viewed freely.
+    std::array<std::byte, kArenaSize> arenaStorage;
+    std::pmr::monotonic_buffer_resource arena{
+        arenaStorage.data(),
+        arenaStorage.size()
+    };
+
+    // Determine the exec name under wich program is beeing executed
+    std::string_view execName = executableName(argv[0]);
+
+    // Parse command line options. Nothing is allocated, the option values
+    // view the strings of `argv'.
+    CliOptionViews options{kDefaultOptionViews};
+    ArgvParser::ParseResult parsed;
+    {
+        TRACE_SCOPE("parse");
+        parsed = kOptionTable.parse(argc, argv, options);
+    }
+
+    // Check if we should stay resident and serve requests --------------------
+    // The setup above is done only once and reused for every request.
+    bool serve = options.m_Serve || !options.m_ServeSocket.empty();
+    if (serve && options.m_Unsupported.empty() && parsed)
+    {
+        // Requests name their own options and inputs
+        if (!batchOptionsOnly(options))
+        {
+            OutputSinks::OutputSink& err = OutputSinks::standardError();
+            err << execName
+                << ": ERROR: other options are not allowed in batch mode\n";
+            err.flush();
+            return EXIT_FAILURE;
+        }
+
+        auto format = options.m_ServeNullDelimited
+            ? BatchServer::RecordFormat::NullDelimited
+            : BatchServer::RecordFormat::Lines;
+        auto handler = [execName, &arena](
+            BatchServer::ArgList const& args,
+            OutputSinks::OutputSink& out,
+            OutputSinks::OutputSink& err
+        ) {
+            // Released up front, so a request that threw does not leave
+            // its memory behind for the next ones
+            arena.release();
+            return serveRequest(execName, args, arena, out, err);
+        };
+
+        if (!options.m_ServeSocket.empty())
+        {
+            return BatchServer::serveUnixSocket(
+                std::string {options.m_ServeSocket},
+                format,
+                handler,
+                OutputSinks::standardError()
+            );
+        }
+
+        return BatchServer::serveStream(
+            0,
+            1,
+            format,
+            handler,
+            OutputSinks::standardError()
+        );
+    }
+
+    return dispatchAction(
+        execName,
+        options,
+        parsed,
+        OutputSinks::standardOutput(),
+        OutputSinks::standardError(),
+        arena
+    );
 }
 
 // End of `cli_template_app.cpp`
@@ -0,0 +1,104 @@
+// ============================================================================
+//
+// File:        count_strategy.cxx
+// Description: Streaming input strategy counting the lines and the bytes of
+//              its inputs, as `wc -lc' (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * count_strategy.cxx: created.
+// * count_strategy.cxx: the chunks are counted as they are read, instead of
+//   the runs of whole records.
+//
+// ============================================================================
+
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "count_strategy.hxx"
+
+// Project headers
+#include "text_kernels.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdlib>
+
+
+// ============================================================================
+// Strategy Definition Section
+// ============================================================================
+
+int
+CountStrategy::operator()(CliActions::ActionContext const& action) const
+{
+    char const delimiter = inputOptions().delimiter;
+    Counts total;
+
+    int status = forEachSource(
+        action,
+        [&](std::string_view name, InputStreams::ChunkSource& source) {
+            Counts counts;
+            std::string_view chunk;
+            while (source.next(chunk)) {
+                counts.lines += TextKernels::countByte(chunk, delimiter);
+                counts.bytes += chunk.size();
+            }
+
+            print(action, counts, inputs().empty() ? std::string_view{} : name);
+            total.lines += counts.lines;
+            total.bytes += counts.bytes;
+        }
+    );
+
+    if (inputs().size() > 1) {
+        print(action, total, "total");
+    }
+
+    return status;
+}
+
+void
+CountStrategy::print(
+    CliActions::ActionContext const& action,
+    Counts const& counts,
+    std::string_view name
+) {
+    action.out() << counts.lines << ' ' << counts.bytes;
+    if (!name.empty()) {
+        action.out() << ' ' << name;
+    }
+    action.out() << '\n';
+}
+
+// End of `count_strategy.cxx'
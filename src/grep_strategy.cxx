@@ -0,0 +1,98 @@
+// ============================================================================
+//
+// File:        grep_strategy.cxx
+// Description: Sample streaming input strategy printing the lines that
+//              contain a fixed string (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * grep_strategy.cxx: created.
+//
+// ============================================================================
+
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "grep_strategy.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdlib>
+
+
+// ============================================================================
+// Strategy Definition Section
+// ============================================================================
+
+int
+GrepStrategy::operator()(CliActions::ActionContext const& action) const
+{
+    bool const prefixed = inputs().size() > 1;
+    char const delimiter = inputOptions().delimiter;
+    bool matched = false;
+
+    int status = forEachInput(
+        action,
+        [&](std::string_view name, InputStreams::RecordReader& reader) {
+            std::string_view records;
+            while (reader.next(records)) {
+                // Search the whole run at once, then widen each match to
+                // its record
+                std::size_t from = 0;
+                std::size_t match;
+                while ((match = records.find(m_Pattern, from))
+                    != std::string_view::npos
+                ) {
+                    std::size_t begin = records.rfind(delimiter, match);
+                    begin = begin == std::string_view::npos ? 0 : begin + 1;
+                    std::size_t end = records.find(delimiter, match);
+                    end = end == std::string_view::npos ? records.size() : end;
+
+                    if (prefixed) {
+                        action.out() << name << ':';
+                    }
+                    action.out() << records.substr(begin, end - begin) << '\n';
+                    matched = true;
+                    from = end + 1;
+                    if (from >= records.size()) {
+                        break;
+                    }
+                }
+            }
+        }
+    );
+
+    return matched && EXIT_SUCCESS == status ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// End of `grep_strategy.cxx'
@@ -33,6 +33,11 @@
 //
 // * hello_world_strategy.cpp: created.
 //
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * hello_world_strategy.cpp: strategy takes `ActionContext' instead of `CliAction'.
+// * hello_world_strategy.cpp: output goes to the action output sink.
+//
 // ============================================================================
 
 
@@ -50,12 +55,12 @@
 
 int
 HelloWorldStrategy::operator()(
-	CliActions::CliAction const& action
+	CliActions::ActionContext const& action
 ) const {
     // Print "Hello, World!" message
-    std::cout << "Hello, World!\n";
+    action.out() << "Hello, World!\n";
 #ifdef USE_DEBUG
-    std::cout << "[DEBUG] in `" << __FILE__
+    action.out() << "[DEBUG] in `" << __FILE__
         << "' at line " << __LINE__
         << ": Debug info: Executed application `"
         << action.execName() << "'\n";;
@@ -0,0 +1,173 @@
+// ============================================================================
+//
+// File:        help_text_generator.cxx
+// Description: Build-time tool rendering the help, usage and version texts of
+//              `cli_template_app' into a header with string constants
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * help_text_generator.cxx: created.
+// * help_text_generator.cxx: strategies are rendered into a memory sink.
+// * help_text_generator.cxx: added the usage shown on a missing argument.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "action_registry.hxx"
+#include "cli_actions.hxx"
+#include "cli_template_app.hxx"
+#include "output_sinks.hxx"
+
+// Standard library headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+
+// ============================================================================
+// Rendering Section
+// ============================================================================
+
+// Executes the strategy under the application name and returns its regular
+// output, the diagnostics are dropped
+template <typename Strategy>
+static std::string render(Strategy const& strategy)
+{
+    OutputSinks::MemorySink out;
+    OutputSinks::MemorySink err;
+    CliActions::executeStatic(kAppName, strategy, out, err);
+
+    return std::string {out.view()};
+}
+
+// Writes the text as a C++ string literal, one source line per text line
+static void writeLiteral(std::ostream& os, std::string_view text)
+{
+    if (text.empty()) {
+        os << "\"\"";
+        return;
+    }
+
+    os << "\"";
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        switch (c) {
+        case '\\': os << "\\\\"; break;
+        case '"':  os << "\\\""; break;
+        case '\t': os << "\\t"; break;
+        case '\n':
+            os << "\\n\"";
+            if (i + 1 < text.size()) {
+                os << "\n    \"";
+            }
+            continue;
+        default:
+            if (c < 0x20 || c >= 0x7f) {
+                // Always three digits, so a following digit can not be
+                // taken as a part of the escape sequence
+                char escape[8];
+                std::snprintf(escape, sizeof(escape), "\\%03o", c);
+                os << escape;
+            } else {
+                os << static_cast<char>(c);
+            }
+        }
+    }
+    if (text.back() != '\n') {
+        os << "\"";
+    }
+}
+
+static void writeConstant(
+    std::ostream& os,
+    std::string_view name,
+    std::string_view text
+) {
+    os << "static constexpr std::string_view " << name << " =\n    ";
+    writeLiteral(os, text);
+    os << ";\n\n";
+}
+
+
+// ============================================================================
+// Main Function Section
+// ============================================================================
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: help_text_generator OUTPUT_HEADER\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ostringstream header;
+    header << "// Generated by `help_text_generator' from `cli_template_app.hxx'"
+        " and `common.hxx'.\n"
+        "// Do not edit.\n\n"
+        "#pragma once\n\n"
+        "#include <string_view>\n\n"
+        "namespace PrerenderedText {\n\n"
+        "// The texts are valid only when executed under this name\n";
+    writeConstant(header, "kExecName", kAppName);
+    writeConstant(header, "kHelp", render(makeShowHelpStrategy()));
+    writeConstant(header, "kUsage", render(makeShowUsageStrategy()));
+    writeConstant(header, "kVersion", render(makeShowVersionStrategy()));
+    writeConstant(
+        header,
+        "kMissingArgumentUsage",
+        render(CliActions::MissingArgumentStrategyClipp{
+            "",
+            appOptions(),
+            CliActions::pageFormatting()
+        })
+    );
+    header << "};\n";
+
+    std::ofstream file(argv[1], std::ios::binary | std::ios::trunc);
+    file << header.str();
+    if (!file)
+    {
+        std::cerr << "help_text_generator: cannot write " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// End of `help_text_generator.cxx'
@@ -0,0 +1,1028 @@
+// ============================================================================
+//
+// File:        input_streams.cxx
+// Description: Streaming input for the CLI actions (definitions)
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * input_streams.cxx: created.
+// * input_streams.cxx: added `RecordReader::reset', the carry buffer comes
+//   from the memory resource given to the reader.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "input_streams.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+// System headers
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// io_uring is driven through the raw system calls, liburing is not needed
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define INPUT_STREAMS_IO_URING
+#endif
+#endif
+#endif
+
+
+// ============================================================================
+// Local Helpers Section
+// ============================================================================
+
+namespace {
+
+    using InputStreams::Backend;
+    using InputStreams::ChunkSource;
+
+    // Reads at most `size' bytes, retrying on signal interruption. Returns
+    // the number of bytes read, zero on end of stream or -1 on error.
+    long readSome(int fd, char* data, std::size_t size)
+    {
+        for (;;) {
+#if defined(_WIN32)
+            long n = _read(fd, data, static_cast<unsigned>(size));
+#else
+            long n = static_cast<long>(::read(fd, data, size));
+#endif
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            return n;
+        }
+    }
+
+    // Size and current position of a regular file. False for anything else
+    // (pipes, terminals, sockets, ...).
+    bool regularFile(int fd, std::uint64_t& size, std::uint64_t& position)
+    {
+#if defined(_WIN32)
+        struct _stat64 status;
+        if (_fstat64(fd, &status) != 0 || (status.st_mode & _S_IFREG) == 0) {
+            return false;
+        }
+        long long current = _lseeki64(fd, 0, SEEK_CUR);
+#else
+        struct stat status;
+        if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode)) {
+            return false;
+        }
+        off_t current = ::lseek(fd, 0, SEEK_CUR);
+#endif
+        size = static_cast<std::uint64_t>(status.st_size);
+        position = current > 0 ? static_cast<std::uint64_t>(current) : 0;
+        position = std::min(position, size);
+
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // ReadSource
+    // ------------------------------------------------------------------------
+    //
+    // Description: Reads the input into two buffers. The first chunk is read
+    //              on the calling thread, and only if there is more to read a
+    //              reader thread takes over, filling one buffer while the
+    //              other one is consumed. Destroying the source before the
+    //              end of a pipe waits for the pending read.
+    //
+    // ------------------------------------------------------------------------
+    class ReadSource final : public ChunkSource {
+    public:
+        ReadSource(int fd, bool regular, std::size_t chunk_size)
+            : ChunkSource{Backend::Read},
+            m_Fd{fd},
+            m_Regular{regular},
+            m_ChunkSize{chunk_size},
+            m_Storage{new char[2 * chunk_size]}
+        {
+            m_Buffers[0].data = m_Storage.get();
+            m_Buffers[1].data = m_Storage.get() + chunk_size;
+        }
+
+        ~ReadSource() override {
+            if (m_Reader.joinable()) {
+                {
+                    std::lock_guard<std::mutex> lock{m_Mutex};
+                    m_Stop = true;
+                }
+                m_Changed.notify_all();
+                m_Reader.join();
+            }
+        }
+
+        bool next(std::string_view& chunk) override {
+            if (m_Finished) {
+                return false;
+            }
+            if (!m_Started) {
+                return first(chunk);
+            }
+            if (!m_Reader.joinable()) {
+                return nextSynchronous(chunk);
+            }
+
+            std::unique_lock<std::mutex> lock{m_Mutex};
+            m_Held = kNone;  // Hand the consumed buffer back to the reader
+            m_Changed.notify_all();
+            m_Changed.wait(lock, [this] { return m_Buffers[m_Wanted].ready; });
+
+            Buffer& buffer = m_Buffers[m_Wanted];
+            buffer.ready = false;
+            if (0 == buffer.size) {
+                m_Error = m_ReaderError;
+                m_Finished = true;
+                return false;
+            }
+            m_Held = m_Wanted;
+            m_Wanted ^= 1;
+            chunk = std::string_view{buffer.data, buffer.size};
+
+            return true;
+        }
+
+    private:
+        static constexpr int kNone{-1};
+
+        struct Buffer {
+            char* data{nullptr};
+            std::size_t size{0};
+            bool ready{false};  // Filled by the reader, not taken yet
+        };
+
+        bool first(std::string_view& chunk) {
+            m_Started = true;
+            if (!nextSynchronous(chunk)) {
+                return false;
+            }
+            // A short read of a regular file is its end
+            if (!m_Regular || chunk.size() == m_ChunkSize) {
+                m_Held = 0;
+                m_Wanted = 1;
+                m_Reader = std::thread{[this] { prefetch(); }};
+            }
+            return true;
+        }
+
+        bool nextSynchronous(std::string_view& chunk) {
+            long n = readSome(m_Fd, m_Buffers[0].data, m_ChunkSize);
+            if (n <= 0) {
+                m_Error = n < 0 ? errno : 0;
+                m_Finished = true;
+                return false;
+            }
+            chunk = std::string_view{
+                m_Buffers[0].data,
+                static_cast<std::size_t>(n)
+            };
+            return true;
+        }
+
+        // Reader thread: fills the buffers in turns, an empty buffer marks
+        // the end of the input
+        void prefetch() {
+            for (int index = 1;; index ^= 1) {
+                Buffer& buffer = m_Buffers[index];
+                {
+                    std::unique_lock<std::mutex> lock{m_Mutex};
+                    m_Changed.wait(lock, [this, index, &buffer] {
+                        return m_Stop || (!buffer.ready && m_Held != index);
+                    });
+                    if (m_Stop) {
+                        return;
+                    }
+                }
+
+                long n = readSome(m_Fd, buffer.data, m_ChunkSize);
+                int error = n < 0 ? errno : 0;
+
+                {
+                    std::lock_guard<std::mutex> lock{m_Mutex};
+                    buffer.size = n > 0 ? static_cast<std::size_t>(n) : 0;
+                    buffer.ready = true;
+                    m_ReaderError = error;
+                }
+                m_Changed.notify_all();
+
+                if (n <= 0) {
+                    return;
+                }
+            }
+        }
+
+        int const m_Fd;
+        bool const m_Regular;
+        std::size_t const m_ChunkSize;
+        std::unique_ptr<char[]> const m_Storage;
+        Buffer m_Buffers[2];
+        bool m_Started{false};
+        bool m_Finished{false};
+
+        // Shared with the reader thread, guarded by the mutex
+        std::thread m_Reader;
+        std::mutex m_Mutex;
+        std::condition_variable m_Changed;
+        int m_Held{kNone};  // Buffer the consumer holds
+        int m_Wanted{0};    // Buffer the consumer takes next
+        int m_ReaderError{0};
+        bool m_Stop{false};
+    };
+
+#if !defined(_WIN32)
+
+    // ------------------------------------------------------------------------
+    // MmapSource
+    // ------------------------------------------------------------------------
+    //
+    // Description: Maps the whole file and hands it out in chunks. The kernel
+    //              reads ahead aggressively (`MADV_SEQUENTIAL'), and the pages
+    //              of the chunks already consumed are dropped from the
+    //              mapping, so the resident memory stays bounded. The file
+    //              must not be truncated while it is read.
+    //
+    // ------------------------------------------------------------------------
+    class MmapSource final : public ChunkSource {
+    public:
+        // Null if the file cannot be mapped
+        static std::unique_ptr<ChunkSource> open(
+            int fd,
+            std::uint64_t size,
+            std::uint64_t position,
+            std::size_t chunk_size
+        ) {
+            if (size > std::numeric_limits<std::size_t>::max()) {
+                return nullptr;
+            }
+            void* map = ::mmap(
+                nullptr,
+                static_cast<std::size_t>(size),
+                PROT_READ,
+                MAP_PRIVATE,
+                fd,
+                0
+            );
+            if (MAP_FAILED == map) {
+                return nullptr;
+            }
+            ::madvise(map, static_cast<std::size_t>(size), MADV_SEQUENTIAL);
+
+            return std::unique_ptr<ChunkSource>{new MmapSource{
+                static_cast<char*>(map),
+                static_cast<std::size_t>(size),
+                static_cast<std::size_t>(position),
+                chunk_size
+            }};
+        }
+
+        ~MmapSource() override {
+            ::munmap(m_Map, m_Size);
+        }
+
+        bool next(std::string_view& chunk) override {
+            releaseConsumed();
+            if (m_Offset >= m_Size) {
+                return false;
+            }
+
+            std::size_t size = std::min(m_ChunkSize, m_Size - m_Offset);
+            chunk = std::string_view{m_Map + m_Offset, size};
+            m_Offset += size;
+
+            return true;
+        }
+
+    private:
+        MmapSource(
+            char* map,
+            std::size_t size,
+            std::size_t position,
+            std::size_t chunk_size
+        ) : ChunkSource{Backend::Mmap},
+            m_Map{map},
+            m_Size{size},
+            m_ChunkSize{chunk_size},
+            m_Page{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))},
+            m_Offset{position},
+            m_Released{0}
+        { }
+
+        // Drops the whole pages before the current offset
+        void releaseConsumed() {
+            std::size_t end = m_Offset / m_Page * m_Page;
+            if (end > m_Released) {
+                ::madvise(m_Map + m_Released, end - m_Released, MADV_DONTNEED);
+                m_Released = end;
+            }
+        }
+
+        char* const m_Map;
+        std::size_t const m_Size;
+        std::size_t const m_ChunkSize;
+        std::size_t const m_Page;
+        std::size_t m_Offset;
+        std::size_t m_Released;
+    };
+
+#endif
+
+#if defined(INPUT_STREAMS_IO_URING)
+
+    // ------------------------------------------------------------------------
+    // Ring
+    // ------------------------------------------------------------------------
+    //
+    // Description: Minimal io_uring: one submission queue filled and one
+    //              completion queue drained by a single thread.
+    //
+    // ------------------------------------------------------------------------
+    class Ring {
+    public:
+        explicit Ring(unsigned entries) {
+            io_uring_params params;
+            std::memset(&params, 0, sizeof(params));
+            int fd = static_cast<int>(
+                ::syscall(__NR_io_uring_setup, entries, &params)
+            );
+            if (fd < 0) {
+                return;
+            }
+            m_Fd = fd;
+
+            m_SqRingSize = params.sq_off.array
+                + params.sq_entries * sizeof(unsigned);
+            m_CqRingSize = params.cq_off.cqes
+                + params.cq_entries * sizeof(io_uring_cqe);
+            bool single = false;
+#if defined(IORING_FEAT_SINGLE_MMAP)
+            single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single) {
+                m_SqRingSize = m_CqRingSize =
+                    std::max(m_SqRingSize, m_CqRingSize);
+            }
+#endif
+
+            m_SqRing = map(m_SqRingSize, IORING_OFF_SQ_RING);
+            m_CqRing = single ? m_SqRing : map(m_CqRingSize, IORING_OFF_CQ_RING);
+            m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            void* sqes = map(m_SqesSize, IORING_OFF_SQES);
+            if (nullptr == m_SqRing || nullptr == m_CqRing || nullptr == sqes) {
+                m_Sqes = static_cast<io_uring_sqe*>(sqes);
+                release();
+                return;
+            }
+            m_Sqes = static_cast<io_uring_sqe*>(sqes);
+
+            char* sq = static_cast<char*>(m_SqRing);
+            m_SqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            m_SqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            m_SqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+            char* cq = static_cast<char*>(m_CqRing);
+            m_CqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            m_CqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            m_CqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            m_Cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        }
+
+        ~Ring() {
+            release();
+        }
+
+        Ring(Ring const&) = delete;
+        Ring& operator=(Ring const&) = delete;
+
+        bool good() const {
+            return m_Fd >= 0;
+        }
+
+        // Queues one request and submits it. The request is zeroed, then
+        // completed by `prepare'.
+        template <typename Prepare>
+        bool submit(Prepare&& prepare) {
+            unsigned tail = *m_SqTail;  // Only this thread writes it
+            unsigned index = tail & *m_SqMask;
+            io_uring_sqe& sqe = m_Sqes[index];
+            std::memset(&sqe, 0, sizeof(sqe));
+            prepare(sqe);
+            m_SqArray[index] = index;
+            __atomic_store_n(m_SqTail, tail + 1, __ATOMIC_RELEASE);
+
+            for (;;) {
+                long n = ::syscall(__NR_io_uring_enter, m_Fd, 1, 0, 0, nullptr, 0);
+                if (n >= 0) {
+                    return true;
+                }
+                if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                    return false;
+                }
+            }
+        }
+
+        // Waits for the next completion
+        bool wait(io_uring_cqe& cqe) {
+            for (;;) {
+                unsigned head = *m_CqHead;  // Only this thread writes it
+                if (head != __atomic_load_n(m_CqTail, __ATOMIC_ACQUIRE)) {
+                    cqe = m_Cqes[head & *m_CqMask];
+                    __atomic_store_n(m_CqHead, head + 1, __ATOMIC_RELEASE);
+                    return true;
+                }
+                long n = ::syscall(
+                    __NR_io_uring_enter,
+                    m_Fd,
+                    0,
+                    1,
+                    IORING_ENTER_GETEVENTS,
+                    nullptr,
+                    0
+                );
+                if (n < 0 && errno != EINTR) {
+                    return false;
+                }
+            }
+        }
+
+    private:
+        void* map(std::size_t size, off_t offset) {
+            void* address = ::mmap(
+                nullptr,
+                size,
+                PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE,
+                m_Fd,
+                offset
+            );
+            return MAP_FAILED == address ? nullptr : address;
+        }
+
+        void release() {
+            if (nullptr != m_Sqes) {
+                ::munmap(m_Sqes, m_SqesSize);
+            }
+            if (nullptr != m_CqRing && m_CqRing != m_SqRing) {
+                ::munmap(m_CqRing, m_CqRingSize);
+            }
+            if (nullptr != m_SqRing) {
+                ::munmap(m_SqRing, m_SqRingSize);
+            }
+            if (m_Fd >= 0) {
+                ::close(m_Fd);
+            }
+            m_Sqes = nullptr;
+            m_SqRing = m_CqRing = nullptr;
+            m_Fd = -1;
+        }
+
+        int m_Fd{-1};
+        void* m_SqRing{nullptr};
+        void* m_CqRing{nullptr};
+        std::size_t m_SqRingSize{0};
+        std::size_t m_CqRingSize{0};
+        std::size_t m_SqesSize{0};
+        io_uring_sqe* m_Sqes{nullptr};
+        unsigned* m_SqTail{nullptr};
+        unsigned* m_SqMask{nullptr};
+        unsigned* m_SqArray{nullptr};
+        unsigned* m_CqHead{nullptr};
+        unsigned* m_CqTail{nullptr};
+        unsigned* m_CqMask{nullptr};
+        io_uring_cqe* m_Cqes{nullptr};
+    };
+
+    // ------------------------------------------------------------------------
+    // IoUringSource
+    // ------------------------------------------------------------------------
+    //
+    // Description: Keeps reads of the following chunks in flight while a
+    //              chunk is consumed. Regular files are read at explicit
+    //              offsets with `DEFAULT_QUEUE_DEPTH' buffers, the chunks are
+    //              handed out in file order whatever order the reads complete
+    //              in. Other inputs have a single read in flight.
+    //
+    // ------------------------------------------------------------------------
+    class IoUringSource final : public ChunkSource {
+    public:
+        // Null if no ring can be set up
+        static std::unique_ptr<ChunkSource> open(
+            int fd,
+            bool regular,
+            std::uint64_t size,
+            std::uint64_t position,
+            std::size_t chunk_size
+        ) {
+            std::size_t slots = regular ? InputStreams::DEFAULT_QUEUE_DEPTH : 2;
+            std::unique_ptr<IoUringSource> source{new IoUringSource{
+                fd, regular, size, position, chunk_size, slots
+            }};
+            if (!source->m_Ring.good()) {
+                return nullptr;
+            }
+            return source;
+        }
+
+        ~IoUringSource() override {
+            // The kernel writes into the buffers until the reads complete
+            for (std::size_t i = 0; i < m_Slots.size(); ++i) {
+                if (m_Slots[i].inFlight && !m_Regular) {
+                    cancel(i);
+                }
+            }
+            io_uring_cqe cqe;
+            while (inFlight() > 0 && m_Ring.wait(cqe)) {
+                if (cqe.user_data < m_Slots.size()) {
+                    m_Slots[cqe.user_data].inFlight = false;
+                }
+            }
+        }
+
+        bool next(std::string_view& chunk) override {
+            if (m_Finished) {
+                return false;
+            }
+            if (!m_Started) {
+                m_Started = true;
+                std::size_t queued = m_Regular ? m_Slots.size() : 1;
+                for (std::size_t i = 0; i < queued; ++i) {
+                    submitSlot(i);
+                }
+            } else {
+                // The consumed slot becomes the last one in the queue
+                if (m_Regular) {
+                    submitSlot(m_Head);
+                }
+                m_Head = (m_Head + 1) % m_Slots.size();
+            }
+
+            Slot& slot = m_Slots[m_Head];
+            while (!slot.done) {
+                if (!slot.inFlight) {
+                    return finish(0);  // Nothing more to read
+                }
+                io_uring_cqe cqe;
+                if (!m_Ring.wait(cqe)) {
+                    return finish(errno);
+                }
+                complete(cqe);
+            }
+            if (0 != slot.error) {
+                return finish(slot.error);
+            }
+            if (0 == slot.filled) {
+                return finish(0);
+            }
+            if (!m_Regular) {
+                // Reads at the current position complete in any order, so
+                // only one is in flight, into the slot consumed last time
+                submitSlot((m_Head + 1) % m_Slots.size());
+            }
+            chunk = std::string_view{slot.data, slot.filled};
+
+            return true;
+        }
+
+    private:
+        struct Slot {
+            char* data{nullptr};
+            std::uint64_t offset{0};
+            std::size_t length{0};
+            std::size_t filled{0};
+            int error{0};
+            bool inFlight{false};
+            bool done{false};
+            iovec iov{};
+        };
+
+        static constexpr std::uint64_t kCancelTag{
+            std::numeric_limits<std::uint64_t>::max()
+        };
+
+        IoUringSource(
+            int fd,
+            bool regular,
+            std::uint64_t size,
+            std::uint64_t position,
+            std::size_t chunk_size,
+            std::size_t slots
+        ) : ChunkSource{Backend::IoUring},
+            m_Ring{static_cast<unsigned>(2 * slots)},
+            m_Fd{fd},
+            m_Regular{regular},
+            m_Size{size},
+            m_NextOffset{position},
+            m_ChunkSize{chunk_size},
+            m_Storage{new char[slots * chunk_size]},
+            m_Slots(slots)
+        {
+            for (std::size_t i = 0; i < slots; ++i) {
+                m_Slots[i].data = m_Storage.get() + i * chunk_size;
+            }
+        }
+
+        // Starts the read of the next chunk into the slot, if any is left
+        void submitSlot(std::size_t index) {
+            Slot& slot = m_Slots[index];
+            slot.done = false;
+            slot.filled = 0;
+            slot.error = 0;
+
+            if (m_Regular) {
+                if (m_NextOffset >= m_Size) {
+                    return;
+                }
+                slot.offset = m_NextOffset;
+                slot.length = static_cast<std::size_t>(
+                    std::min<std::uint64_t>(m_ChunkSize, m_Size - m_NextOffset)
+                );
+                m_NextOffset += slot.length;
+            } else {
+                if (m_EndOfStream) {
+                    return;
+                }
+                slot.offset = static_cast<std::uint64_t>(-1);  // Current position
+                slot.length = m_ChunkSize;
+            }
+            read(index);
+        }
+
+        // Queues the read of the unfilled part of the slot
+        void read(std::size_t index) {
+            Slot& slot = m_Slots[index];
+            slot.iov.iov_base = slot.data + slot.filled;
+            slot.iov.iov_len = slot.length - slot.filled;
+            std::uint64_t offset = m_Regular
+                ? slot.offset + slot.filled
+                : slot.offset;
+
+            slot.inFlight = m_Ring.submit([&](io_uring_sqe& sqe) {
+                sqe.opcode = IORING_OP_READV;
+                sqe.fd = m_Fd;
+                sqe.off = offset;
+                sqe.addr = reinterpret_cast<std::uint64_t>(&slot.iov);
+                sqe.len = 1;
+                sqe.user_data = index;
+            });
+            if (!slot.inFlight) {
+                slot.error = errno;
+                slot.done = true;
+            }
+        }
+
+        void complete(io_uring_cqe const& cqe) {
+            if (cqe.user_data >= m_Slots.size()) {
+                return;  // Cancellation
+            }
+            Slot& slot = m_Slots[cqe.user_data];
+            slot.inFlight = false;
+
+            if (cqe.res < 0) {
+                if (-EINTR == cqe.res || -EAGAIN == cqe.res) {
+                    read(cqe.user_data);
+                } else {
+                    slot.error = -cqe.res;
+                    slot.done = true;
+                }
+                return;
+            }
+
+            slot.filled += static_cast<std::size_t>(cqe.res);
+            if (!m_Regular) {
+                m_EndOfStream = 0 == cqe.res;
+                slot.done = true;
+            } else if (0 == cqe.res || slot.filled == slot.length) {
+                slot.done = true;  // A file truncated meanwhile ends early
+            } else {
+                read(cqe.user_data);  // Short read, continue
+            }
+        }
+
+        void cancel(std::size_t index) {
+#if defined(IORING_OP_ASYNC_CANCEL)
+            m_Ring.submit([index](io_uring_sqe& sqe) {
+                sqe.opcode = IORING_OP_ASYNC_CANCEL;
+                sqe.fd = -1;
+                sqe.addr = index;
+                sqe.user_data = kCancelTag;
+            });
+#else
+            static_cast<void>(index);
+#endif
+        }
+
+        std::size_t inFlight() const {
+            return static_cast<std::size_t>(std::count_if(
+                m_Slots.begin(),
+                m_Slots.end(),
+                [](Slot const& slot) { return slot.inFlight; }
+            ));
+        }
+
+        bool finish(int error) {
+            m_Error = error;
+            m_Finished = true;
+            return false;
+        }
+
+        Ring m_Ring;
+        int const m_Fd;
+        bool const m_Regular;
+        std::uint64_t const m_Size;
+        std::uint64_t m_NextOffset;
+        std::size_t const m_ChunkSize;
+        std::unique_ptr<char[]> const m_Storage;
+        std::vector<Slot> m_Slots;
+        std::size_t m_Head{0};  // Slot of the next chunk in order
+        bool m_Started{false};
+        bool m_Finished{false};
+        bool m_EndOfStream{false};
+    };
+
+#endif
+
+};
+
+
+// ============================================================================
+// Backend Selection Section
+// ============================================================================
+
+char const*
+InputStreams::backendName(Backend backend)
+{
+    switch (backend) {
+    case Backend::Mmap:
+        return "mmap";
+    case Backend::Read:
+        return "read";
+    case Backend::IoUring:
+        return "io_uring";
+    case Backend::Auto:
+    default:
+        return "auto";
+    }
+}
+
+bool
+InputStreams::parseBackend(std::string_view name, Backend& backend)
+{
+    for (Backend candidate : {
+        Backend::Auto,
+        Backend::Mmap,
+        Backend::Read,
+        Backend::IoUring
+    }) {
+        if (name == backendName(candidate)) {
+            backend = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+InputStreams::backendAvailable(Backend backend)
+{
+    switch (backend) {
+    case Backend::Mmap:
+#if defined(_WIN32)
+        return false;
+#else
+        return true;
+#endif
+    case Backend::IoUring: {
+#if defined(INPUT_STREAMS_IO_URING)
+        // Kernels without io_uring, or with it disabled (e.g. by seccomp in
+        // containers), fail the setup
+        static bool const available = Ring{2}.good();
+        return available;
+#else
+        return false;
+#endif
+    }
+    case Backend::Auto:
+    case Backend::Read:
+    default:
+        return true;
+    }
+}
+
+std::unique_ptr<InputStreams::ChunkSource>
+InputStreams::openChunkSource(int fd, Backend backend, std::size_t chunk_size)
+{
+    if (0 == chunk_size) {
+        chunk_size = DEFAULT_CHUNK_SIZE;
+    }
+
+    std::uint64_t size = 0;
+    std::uint64_t position = 0;
+    bool regular = regularFile(fd, size, position);
+
+    // Files of special file systems (e.g. /proc) report no size, they are
+    // read until the end instead
+    if (regular && 0 == size) {
+        regular = false;
+    }
+
+    if (Backend::Auto == backend) {
+        backend = regular ? Backend::Mmap : Backend::Read;
+    }
+
+#if !defined(_WIN32)
+    if (Backend::Mmap == backend && regular) {
+        if (auto source = MmapSource::open(fd, size, position, chunk_size)) {
+            return source;
+        }
+    }
+#endif
+
+#if defined(INPUT_STREAMS_IO_URING)
+    if (Backend::IoUring == backend && backendAvailable(Backend::IoUring)) {
+        if (auto source = IoUringSource::open(
+            fd,
+            regular,
+            size,
+            position,
+            chunk_size
+        )) {
+            return source;
+        }
+    }
+#endif
+
+    return std::make_unique<ReadSource>(fd, regular, chunk_size);
+}
+
+
+// ============================================================================
+// RecordReader Definition Section
+// ============================================================================
+
+InputStreams::RecordReader::RecordReader(
+    ChunkSource& source,
+    char delimiter,
+    std::pmr::memory_resource* memory
+) : m_Source{&source},
+    m_Delimiter{delimiter},
+    m_Carry{memory},
+    m_CarryHandedOut{false}
+{ }
+
+void
+InputStreams::RecordReader::reset(ChunkSource& source)
+{
+    m_Source = &source;
+    m_Pending = std::string_view{};
+    m_Carry.clear();
+    m_CarryHandedOut = false;
+}
+
+bool
+InputStreams::RecordReader::next(std::string_view& records)
+{
+    if (m_CarryHandedOut) {
+        m_Carry.clear();
+        m_CarryHandedOut = false;
+    }
+
+    for (;;) {
+        if (!m_Pending.empty()) {
+            if (!m_Carry.empty()) {
+                // Complete the record spanning the chunks
+                std::size_t end = m_Pending.find(m_Delimiter);
+                std::size_t take = end == std::string_view::npos
+                    ? m_Pending.size()
+                    : end + 1;
+                m_Carry.insert(
+                    m_Carry.end(),
+                    m_Pending.data(),
+                    m_Pending.data() + take
+                );
+                m_Pending.remove_prefix(take);
+                if (end == std::string_view::npos) {
+                    continue;
+                }
+                records = std::string_view{m_Carry.data(), m_Carry.size()};
+                m_CarryHandedOut = true;
+                return true;
+            }
+
+            // Whole records of the chunk, the incomplete tail is carried
+            std::size_t last = m_Pending.rfind(m_Delimiter);
+            if (last == std::string_view::npos) {
+                m_Carry.assign(m_Pending.begin(), m_Pending.end());
+                m_Pending = std::string_view{};
+                continue;
+            }
+            records = m_Pending.substr(0, last + 1);
+            std::string_view tail = m_Pending.substr(last + 1);
+            m_Carry.assign(tail.begin(), tail.end());
+            m_Pending = std::string_view{};
+            return true;
+        }
+
+        if (!m_Source->next(m_Pending)) {
+            m_Pending = std::string_view{};
+            if (m_Carry.empty() || 0 != m_Source->error()) {
+                return false;
+            }
+            // Last record without the delimiter
+            records = std::string_view{m_Carry.data(), m_Carry.size()};
+            m_CarryHandedOut = true;
+            return true;
+        }
+    }
+}
+
+
+// ============================================================================
+// InputFile Definition Section
+// ============================================================================
+
+InputStreams::InputFile::InputFile(char const* path)
+    : m_Fd{-1},
+      m_Error{0},
+      m_Owned{nullptr != path}
+{
+    if (nullptr == path) {
+        m_Fd = 0;
+#if defined(_WIN32)
+        _setmode(m_Fd, _O_BINARY);
+#endif
+        return;
+    }
+
+#if defined(_WIN32)
+    m_Fd = _open(path, _O_RDONLY | _O_BINARY);
+#else
+    m_Fd = ::open(path, O_RDONLY | O_CLOEXEC);
+#endif
+    if (m_Fd < 0) {
+        m_Error = errno;
+    }
+}
+
+InputStreams::InputFile::~InputFile()
+{
+    if (m_Owned && m_Fd >= 0) {
+#if defined(_WIN32)
+        _close(m_Fd);
+#else
+        ::close(m_Fd);
+#endif
+    }
+}
+
+// End of `input_streams.cxx'
@@ -0,0 +1,371 @@
+// ============================================================================
+//
+// File:        output_sinks.cxx
+// Description: File descriptor and memory mapped file output sinks
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * output_sinks.cxx: created.
+// * output_sinks.cxx: standard sinks write through static buffers.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "output_sinks.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+// System headers
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+
+// ============================================================================
+// Local Constants Section
+// ============================================================================
+
+namespace {
+
+    // Writes at least this large are passed to the kernel in place
+    constexpr std::size_t kLargeWriteDivisor{4};
+
+    // Mapped files grow at least by this much at a time
+    constexpr std::size_t kMinMappingGrowth{1024 * 1024};
+
+};
+
+
+// ============================================================================
+// FdSink Definition Section
+// ============================================================================
+
+OutputSinks::FdSink::FdSink(
+    int fd,
+    bool auto_flush,
+    std::size_t buffer_size
+) : m_Fd{fd},
+    m_AutoFlush{auto_flush},
+    m_OwnedBuffer{
+        new char[buffer_size > 0 ? buffer_size : DEFAULT_BUFFER_SIZE]
+    },
+    m_Buffer{m_OwnedBuffer.get()},
+    m_BufferSize{buffer_size > 0 ? buffer_size : DEFAULT_BUFFER_SIZE},
+    m_Used{0},
+    m_PieceCount{0},
+    m_Error{false}
+{ }
+
+OutputSinks::FdSink::FdSink(
+    int fd,
+    bool auto_flush,
+    char* buffer,
+    std::size_t buffer_size
+) : m_Fd{fd},
+    m_AutoFlush{auto_flush},
+    m_Buffer{buffer},
+    m_BufferSize{buffer_size},
+    m_Used{0},
+    m_PieceCount{0},
+    m_Error{false}
+{ }
+
+OutputSinks::FdSink::~FdSink()
+{
+    flush();
+}
+
+void
+OutputSinks::FdSink::write(std::string_view data)
+{
+    if (data.empty()) {
+        return;
+    }
+
+    // Large data is handed to the kernel in place while it is still valid
+    if (data.size() >= m_BufferSize / kLargeWriteDivisor) {
+        appendPiece(data.data(), data.size());
+        m_Error = !flush() || m_Error;
+        return;
+    }
+
+    if (m_Used + data.size() > m_BufferSize) {
+        m_Error = !flush() || m_Error;
+    }
+
+    char* target = m_Buffer + m_Used;
+    std::memcpy(target, data.data(), data.size());
+    m_Used += data.size();
+    appendPiece(target, data.size());
+
+    if (m_AutoFlush || m_PieceCount >= DEFAULT_MAX_PIECES) {
+        m_Error = !flush() || m_Error;
+    }
+}
+
+void
+OutputSinks::FdSink::writeStatic(std::string_view data)
+{
+    if (data.empty()) {
+        return;
+    }
+
+    appendPiece(data.data(), data.size());
+
+    if (m_AutoFlush || m_PieceCount >= DEFAULT_MAX_PIECES) {
+        m_Error = !flush() || m_Error;
+    }
+}
+
+bool
+OutputSinks::FdSink::flush()
+{
+    bool ok = !m_Error;
+    m_Error = false;
+
+    std::size_t first = 0;
+    while (first < m_PieceCount) {
+#if defined(_WIN32)
+        long n = _write(
+            m_Fd,
+            m_Pieces[first].data(),
+            static_cast<unsigned>(m_Pieces[first].size())
+        );
+#else
+        struct iovec iov[DEFAULT_MAX_PIECES];
+        int count = 0;
+        for (std::size_t i = first;
+            i < m_PieceCount && count < static_cast<int>(DEFAULT_MAX_PIECES);
+            ++i
+        ) {
+            iov[count].iov_base = const_cast<char*>(m_Pieces[i].data());
+            iov[count].iov_len = m_Pieces[i].size();
+            ++count;
+        }
+        long n = static_cast<long>(::writev(m_Fd, iov, count));
+#endif
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ok = false;
+            break;
+        }
+
+        // Skip the fully written pieces and trim the partly written one
+        std::size_t written = static_cast<std::size_t>(n);
+        while (first < m_PieceCount && written >= m_Pieces[first].size()) {
+            written -= m_Pieces[first].size();
+            ++first;
+        }
+        if (first < m_PieceCount) {
+            m_Pieces[first].remove_prefix(written);
+        }
+    }
+
+    m_PieceCount = 0;
+    m_Used = 0;
+
+    return ok;
+}
+
+void
+OutputSinks::FdSink::appendPiece(char const* data, std::size_t size)
+{
+    // Consecutive writes into the buffer end up in a single piece
+    if (0 != m_PieceCount) {
+        std::string_view& last = m_Pieces[m_PieceCount - 1];
+        if (last.data() + last.size() == data) {
+            last = std::string_view{last.data(), last.size() + size};
+            return;
+        }
+    }
+    m_Pieces[m_PieceCount++] = std::string_view{data, size};
+}
+
+
+// ============================================================================
+// MappedFileSink Definition Section
+// ============================================================================
+
+OutputSinks::MappedFileSink::MappedFileSink(std::string const& path)
+    : m_Fd{-1},
+      m_Map{nullptr},
+      m_Capacity{0},
+      m_Size{0},
+      m_Good{false}
+{
+#if defined(_WIN32)
+    m_Fd = _open(
+        path.c_str(),
+        _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY,
+        _S_IREAD | _S_IWRITE
+    );
+#else
+    m_Fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+#endif
+    m_Good = m_Fd >= 0;
+}
+
+OutputSinks::MappedFileSink::~MappedFileSink()
+{
+    close();
+}
+
+void
+OutputSinks::MappedFileSink::write(std::string_view data)
+{
+    if (!m_Good || data.empty()) {
+        return;
+    }
+
+#if defined(_WIN32)
+    // No mapping on this platform, write through
+    m_Good = _write(m_Fd, data.data(), static_cast<unsigned>(data.size()))
+        == static_cast<int>(data.size());
+    m_Size += data.size();
+#else
+    if (!reserve(m_Size + data.size())) {
+        m_Good = false;
+        return;
+    }
+    std::memcpy(m_Map + m_Size, data.data(), data.size());
+    m_Size += data.size();
+#endif
+}
+
+bool
+OutputSinks::MappedFileSink::flush()
+{
+    // The data is in the page cache already, the kernel writes it back
+    return m_Good;
+}
+
+bool
+OutputSinks::MappedFileSink::close()
+{
+    if (m_Fd < 0) {
+        return m_Good;
+    }
+
+#if defined(_WIN32)
+    m_Good = _close(m_Fd) == 0 && m_Good;
+#else
+    if (m_Map != nullptr) {
+        m_Good = ::munmap(m_Map, m_Capacity) == 0 && m_Good;
+        m_Map = nullptr;
+    }
+    // Drop the unused tail of the last growth step
+    m_Good = ::ftruncate(m_Fd, static_cast<off_t>(m_Size)) == 0 && m_Good;
+    m_Good = ::close(m_Fd) == 0 && m_Good;
+#endif
+    m_Fd = -1;
+
+    return m_Good;
+}
+
+bool
+OutputSinks::MappedFileSink::reserve(std::size_t size)
+{
+#if defined(_WIN32)
+    (void)size;
+    return true;
+#else
+    if (size <= m_Capacity) {
+        return true;
+    }
+
+    std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    std::size_t capacity = std::max({size, m_Capacity * 2, kMinMappingGrowth});
+    capacity = (capacity + page - 1) / page * page;
+
+    if (::ftruncate(m_Fd, static_cast<off_t>(capacity)) != 0) {
+        return false;
+    }
+    if (m_Map != nullptr) {
+        ::munmap(m_Map, m_Capacity);
+        m_Map = nullptr;
+    }
+
+    void* map = ::mmap(
+        nullptr,
+        capacity,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        m_Fd,
+        0
+    );
+    if (map == MAP_FAILED) {
+        m_Capacity = 0;
+        return false;
+    }
+    m_Map = static_cast<char*>(map);
+    m_Capacity = capacity;
+
+    return true;
+#endif
+}
+
+
+// ============================================================================
+// Standard Sinks Definition Section
+// ============================================================================
+
+OutputSinks::OutputSink&
+OutputSinks::standardOutput()
+{
+    static char buffer[DEFAULT_BUFFER_SIZE];
+    static FdSink sink{1, false, buffer, sizeof(buffer)};
+    return sink;
+}
+
+OutputSinks::OutputSink&
+OutputSinks::standardError()
+{
+    static char buffer[DEFAULT_BUFFER_SIZE];
+    static FdSink sink{2, false, buffer, sizeof(buffer)};
+    return sink;
+}
+
+// End of `output_sinks.cxx'
@@ -0,0 +1,294 @@
+// ============================================================================
+//
+// File:        text_kernels.cxx
+// Description: Scalar text kernels and the runtime selection of the variant
+//              (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * text_kernels.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "text_kernels.hxx"
+
+// Standard library headers
+#include <cstddef>
+
+// System headers
+#if defined(_MSC_VER)
+#include <intrin.h>  // __cpuid, _xgetbv
+#endif
+
+
+// ============================================================================
+// Scalar Kernels Section
+// ============================================================================
+
+namespace {
+
+std::size_t
+findByteScalar(char const* data, std::size_t size, char byte)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        if (data[i] == byte) {
+            return i;
+        }
+    }
+    return size;
+}
+
+std::size_t
+countByteScalar(char const* data, std::size_t size, char byte)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        count += data[i] == byte ? 1 : 0;
+    }
+    return count;
+}
+
+void
+foldCaseScalar(char const* data, std::size_t size, char* out)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        char c = data[i];
+        out[i] = ('A' <= c && c <= 'Z')
+            ? static_cast<char>(c + ('a' - 'A'))
+            : c;
+    }
+}
+
+bool
+validUtf8Scalar(char const* data, std::size_t size)
+{
+    auto const* text = reinterpret_cast<unsigned char const*>(data);
+    std::size_t i = 0;
+    while (i < size) {
+        if (text[i] < 0x80) {
+            ++i;
+            continue;
+        }
+        std::size_t length =
+            TextKernels::Detail::utf8SequenceLength(text + i, size - i);
+        if (0 == length) {
+            return false;
+        }
+        i += length;
+    }
+    return true;
+}
+
+bool
+continuation(unsigned char byte)
+{
+    return 0x80 == (byte & 0xC0);
+}
+
+} // namespace
+
+std::size_t
+TextKernels::Detail::utf8SequenceLength(
+    unsigned char const* text,
+    std::size_t size
+) {
+    unsigned char lead = text[0];
+    if (lead < 0x80) {
+        return 1;
+    }
+    // Continuation bytes and the overlong two byte leads C0 and C1
+    if (lead < 0xC2) {
+        return 0;
+    }
+    if (lead < 0xE0) {
+        return size >= 2 && continuation(text[1]) ? 2 : 0;
+    }
+    if (lead < 0xF0) {
+        if (size < 3) {
+            return 0;
+        }
+        // E0 would be overlong below A0, ED a surrogate from A0 on
+        unsigned char low = 0xE0 == lead ? 0xA0 : 0x80;
+        unsigned char high = 0xED == lead ? 0x9F : 0xBF;
+        return low <= text[1] && text[1] <= high && continuation(text[2])
+            ? 3 : 0;
+    }
+    if (lead < 0xF5) {
+        if (size < 4) {
+            return 0;
+        }
+        // F0 would be overlong below 90, F4 past U+10FFFF from 90 on
+        unsigned char low = 0xF0 == lead ? 0x90 : 0x80;
+        unsigned char high = 0xF4 == lead ? 0x8F : 0xBF;
+        return low <= text[1] && text[1] <= high
+            && continuation(text[2]) && continuation(text[3])
+            ? 4 : 0;
+    }
+    return 0;
+}
+
+TextKernels::Kernels const TextKernels::Detail::kScalarKernels{
+    TextKernels::Isa::Scalar,
+    findByteScalar,
+    countByteScalar,
+    foldCaseScalar,
+    validUtf8Scalar
+};
+
+
+// ============================================================================
+// Variant Selection Section
+// ============================================================================
+
+namespace {
+
+// The CPU and the operating system (which must save the wider registers)
+// support the ISA
+bool
+cpuSupports(TextKernels::Isa isa)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int const maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    bool const osxsave = 0 != (info[2] & (1 << 27));
+    unsigned long long const xcr0 = osxsave ? _xgetbv(0) : 0;
+    bool const ymm = 0x06 == (xcr0 & 0x06);
+    bool const zmm = 0xE6 == (xcr0 & 0xE6);
+
+    int leaf7[4] = {0, 0, 0, 0};
+    if (maxLeaf >= 7) {
+        __cpuidex(leaf7, 7, 0);
+    }
+    bool const avx2 = 0 != (leaf7[1] & (1 << 5));
+    bool const avx512f = 0 != (leaf7[1] & (1 << 16));
+    bool const avx512bw = 0 != (leaf7[1] & (1 << 30));
+
+    switch (isa) {
+    case TextKernels::Isa::Scalar:
+    case TextKernels::Isa::Sse2:
+        return true;
+    case TextKernels::Isa::Avx2:
+        return ymm && avx2;
+    case TextKernels::Isa::Avx512:
+        return zmm && avx512f && avx512bw;
+    }
+    return false;
+#else
+    // The checks include the operating system support of the registers
+    __builtin_cpu_init();
+    switch (isa) {
+    case TextKernels::Isa::Scalar:
+    case TextKernels::Isa::Sse2:
+        return true;
+    case TextKernels::Isa::Avx2:
+        return __builtin_cpu_supports("avx2");
+    case TextKernels::Isa::Avx512:
+        return __builtin_cpu_supports("avx512f")
+            && __builtin_cpu_supports("avx512bw");
+    }
+    return false;
+#endif
+#else
+    return TextKernels::Isa::Scalar == isa;
+#endif
+}
+
+} // namespace
+
+char const*
+TextKernels::isaName(Isa isa)
+{
+    switch (isa) {
+    case Isa::Scalar:
+        return "scalar";
+    case Isa::Sse2:
+        return "sse2";
+    case Isa::Avx2:
+        return "avx2";
+    case Isa::Avx512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+TextKernels::Kernels const*
+TextKernels::variant(Isa isa)
+{
+    Kernels const* kernels = nullptr;
+    switch (isa) {
+    case Isa::Scalar:
+        kernels = &Detail::kScalarKernels;
+        break;
+    case Isa::Sse2:
+#if defined(TEXT_KERNELS_SSE2)
+        kernels = &Detail::kSse2Kernels;
+#endif
+        break;
+    case Isa::Avx2:
+#if defined(TEXT_KERNELS_AVX2)
+        kernels = &Detail::kAvx2Kernels;
+#endif
+        break;
+    case Isa::Avx512:
+#if defined(TEXT_KERNELS_AVX512)
+        kernels = &Detail::kAvx512Kernels;
+#endif
+        break;
+    }
+
+    return nullptr != kernels && cpuSupports(isa) ? kernels : nullptr;
+}
+
+TextKernels::Kernels const&
+TextKernels::active()
+{
+    // Widest variant first
+    static Kernels const* const selected = [] {
+        for (Isa isa : {Isa::Avx512, Isa::Avx2, Isa::Sse2}) {
+            if (Kernels const* kernels = variant(isa)) {
+                return kernels;
+            }
+        }
+        return &Detail::kScalarKernels;
+    }();
+
+    return *selected;
+}
+
+// End of `text_kernels.cxx'
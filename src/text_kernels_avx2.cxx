@@ -0,0 +1,418 @@
+// ============================================================================
+//
+// File:        text_kernels_avx2.cxx
+// Description: AVX2 variant of the text kernels (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * text_kernels_avx2.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "text_kernels.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// System headers
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+// ============================================================================
+// AVX2 Kernels Section
+// ============================================================================
+
+// Only functions local to this translation unit, see text_kernels.hxx
+namespace {
+
+constexpr std::size_t kBlock{32};
+
+// Index of the lowest set bit, the mask must not be zero
+unsigned
+lowestBit(std::uint64_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+}
+
+__m256i
+load(char const* data)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data));
+}
+
+std::uint64_t
+byteMask(__m256i bytes)
+{
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes));
+}
+
+std::size_t
+findByteAvx2(char const* data, std::size_t size, char byte)
+{
+    __m256i const needle = _mm256_set1_epi8(byte);
+    std::size_t i = 0;
+
+    // Two blocks per test of the mask
+    for (; i + 2 * kBlock <= size; i += 2 * kBlock) {
+        std::uint64_t const mask =
+            byteMask(_mm256_cmpeq_epi8(load(data + i), needle))
+            | byteMask(_mm256_cmpeq_epi8(load(data + i + kBlock), needle))
+                << 32;
+        if (0 != mask) {
+            return i + lowestBit(mask);
+        }
+    }
+    for (; i + kBlock <= size; i += kBlock) {
+        std::uint64_t const mask =
+            byteMask(_mm256_cmpeq_epi8(load(data + i), needle));
+        if (0 != mask) {
+            return i + lowestBit(mask);
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == byte) {
+            return i;
+        }
+    }
+    return size;
+}
+
+std::size_t
+countByteAvx2(char const* data, std::size_t size, char byte)
+{
+    __m256i const needle = _mm256_set1_epi8(byte);
+    __m256i const zero = _mm256_setzero_si256();
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+    while (i + kBlock <= size) {
+        // Byte counters, summed up before any of them can overflow
+        std::size_t blocks = (size - i) / kBlock;
+        blocks = blocks < 255 ? blocks : 255;
+        __m256i counters = zero;
+        for (std::size_t block = 0; block < blocks; ++block, i += kBlock) {
+            counters = _mm256_sub_epi8(
+                counters,
+                _mm256_cmpeq_epi8(load(data + i), needle)
+            );
+        }
+        __m256i const sums = _mm256_sad_epu8(counters, zero);
+        __m128i const halves = _mm_add_epi64(
+            _mm256_castsi256_si128(sums),
+            _mm256_extracti128_si256(sums, 1)
+        );
+        count += static_cast<std::size_t>(_mm_cvtsi128_si64(halves))
+            + static_cast<std::size_t>(_mm_extract_epi64(halves, 1));
+    }
+    for (; i < size; ++i) {
+        count += data[i] == byte ? 1 : 0;
+    }
+    return count;
+}
+
+void
+foldCaseAvx2(char const* data, std::size_t size, char* out)
+{
+    // 'A' to 'Z' moved to the bottom of the signed byte range
+    __m256i const shift = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+    __m256i const bound = _mm256_set1_epi8(static_cast<char>(-128 + 26));
+    __m256i const lower = _mm256_set1_epi8(0x20);
+    std::size_t i = 0;
+
+    for (; i + kBlock <= size; i += kBlock) {
+        __m256i const text = load(data + i);
+        __m256i const upper =
+            _mm256_cmpgt_epi8(bound, _mm256_add_epi8(text, shift));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(out + i),
+            _mm256_or_si256(text, _mm256_and_si256(upper, lower))
+        );
+    }
+    for (; i < size; ++i) {
+        char const c = data[i];
+        out[i] = ('A' <= c && c <= 'Z')
+            ? static_cast<char>(c + ('a' - 'A'))
+            : c;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// UTF-8 validation
+// ----------------------------------------------------------------------------
+//
+// Lookup algorithm of Keiser and Lemire ("Validating UTF-8 in less than one
+// instruction per byte", 2021). Every byte is classified, together with the
+// byte before it, through three 16 entry tables indexed by nibbles. Each
+// table entry is a set of the errors the nibble allows; the errors left in
+// all three sets are the ones the pair of bytes makes. The continuation
+// bytes owed to the three and four byte leads two and three bytes back are
+// checked separately.
+//
+// ----------------------------------------------------------------------------
+
+// Error bits of a pair of bytes
+constexpr std::uint8_t kTooShort{1 << 0};     // Lead not followed by a
+                                              // continuation
+constexpr std::uint8_t kTooLong{1 << 1};      // ASCII followed by a
+                                              // continuation
+constexpr std::uint8_t kOverlong3{1 << 2};    // E0 80..9F
+constexpr std::uint8_t kTooLarge{1 << 3};     // F4 90..BF, F5..FF
+constexpr std::uint8_t kSurrogate{1 << 4};    // ED A0..BF
+constexpr std::uint8_t kOverlong2{1 << 5};    // C0, C1
+constexpr std::uint8_t kTooLarge1000{1 << 6}; // F5..FF 80..8F
+constexpr std::uint8_t kOverlong4{1 << 6};    // F0 80..8F
+constexpr std::uint8_t kTwoConts{1 << 7};     // Continuation after a
+                                              // continuation
+constexpr std::uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+__m256i
+table(
+    std::uint8_t e0, std::uint8_t e1, std::uint8_t e2, std::uint8_t e3,
+    std::uint8_t e4, std::uint8_t e5, std::uint8_t e6, std::uint8_t e7,
+    std::uint8_t e8, std::uint8_t e9, std::uint8_t ea, std::uint8_t eb,
+    std::uint8_t ec, std::uint8_t ed, std::uint8_t ee, std::uint8_t ef
+) {
+    return _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        static_cast<char>(e0), static_cast<char>(e1),
+        static_cast<char>(e2), static_cast<char>(e3),
+        static_cast<char>(e4), static_cast<char>(e5),
+        static_cast<char>(e6), static_cast<char>(e7),
+        static_cast<char>(e8), static_cast<char>(e9),
+        static_cast<char>(ea), static_cast<char>(eb),
+        static_cast<char>(ec), static_cast<char>(ed),
+        static_cast<char>(ee), static_cast<char>(ef)
+    ));
+}
+
+__m256i
+highNibbles(__m256i bytes)
+{
+    return _mm256_and_si256(
+        _mm256_srli_epi16(bytes, 4),
+        _mm256_set1_epi8(0x0F)
+    );
+}
+
+// Bytes of the input shifted by `N', the last bytes of the previous input
+// shifted in
+template <int N>
+__m256i
+previous(__m256i input, __m256i prior)
+{
+    return _mm256_alignr_epi8(
+        input,
+        _mm256_permute2x128_si256(prior, input, 0x21),
+        16 - N
+    );
+}
+
+class Utf8Checker {
+public:
+    void check(__m256i input) {
+        if (0 == _mm256_movemask_epi8(input)) {
+            // A sequence left incomplete by the previous input is an error
+            m_Error = _mm256_or_si256(m_Error, m_PriorIncomplete);
+            m_PriorIncomplete = _mm256_setzero_si256();
+        } else {
+            __m256i const prev1 = previous<1>(input, m_Prior);
+            __m256i const special = specialCases(input, prev1);
+            m_Error = _mm256_or_si256(
+                m_Error,
+                multibyteLengths(input, m_Prior, special)
+            );
+            m_PriorIncomplete = incomplete(input);
+        }
+        m_Prior = input;
+    }
+
+    // Checks the input that does not fill a block, zero padded so that a
+    // sequence truncated by the end of the input is an error
+    bool finish(char const* data, std::size_t size) {
+        alignas(32) char tail[kBlock] = {};
+        std::memcpy(tail, data, size);
+        check(_mm256_load_si256(reinterpret_cast<__m256i const*>(tail)));
+        m_Error = _mm256_or_si256(m_Error, m_PriorIncomplete);
+        return 0 != _mm256_testz_si256(m_Error, m_Error);
+    }
+
+private:
+    static __m256i specialCases(__m256i input, __m256i prev1) {
+        __m256i const byte1High = _mm256_shuffle_epi8(
+            table(
+                // 0_______ ASCII
+                kTooLong, kTooLong, kTooLong, kTooLong,
+                kTooLong, kTooLong, kTooLong, kTooLong,
+                // 10______ continuation
+                kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+                // 1100____ two byte lead
+                kTooShort | kOverlong2,
+                // 1101____ two byte lead
+                kTooShort,
+                // 1110____ three byte lead
+                kTooShort | kOverlong3 | kSurrogate,
+                // 1111____ four byte lead
+                kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+            ),
+            highNibbles(prev1)
+        );
+        __m256i const byte1Low = _mm256_shuffle_epi8(
+            table(
+                // ____0000
+                kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+                // ____0001
+                kCarry | kOverlong2,
+                // ____001_
+                kCarry,
+                kCarry,
+                // ____0100
+                kCarry | kTooLarge,
+                // ____0101 to ____1100
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                // ____1101
+                kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+                // ____111_
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000
+            ),
+            _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F))
+        );
+        __m256i const byte2High = _mm256_shuffle_epi8(
+            table(
+                // 0_______ ASCII
+                kTooShort, kTooShort, kTooShort, kTooShort,
+                kTooShort, kTooShort, kTooShort, kTooShort,
+                // 1000____
+                kTooLong | kOverlong2 | kTwoConts | kOverlong3
+                    | kTooLarge1000 | kOverlong4,
+                // 1001____
+                kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+                // 101_____
+                kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+                kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+                // 11______ lead
+                kTooShort, kTooShort, kTooShort, kTooShort
+            ),
+            highNibbles(input)
+        );
+        return _mm256_and_si256(
+            _mm256_and_si256(byte1High, byte1Low),
+            byte2High
+        );
+    }
+
+    // Bytes two and three after a three or four byte lead must be
+    // continuations, which `specialCases' reports as two in a row
+    static __m256i multibyteLengths(
+        __m256i input,
+        __m256i prior,
+        __m256i special
+    ) {
+        __m256i const prev2 = previous<2>(input, prior);
+        __m256i const prev3 = previous<3>(input, prior);
+        // Only 111_____ and 1111____ keep the high bit
+        __m256i const third = _mm256_subs_epu8(
+            prev2,
+            _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))
+        );
+        __m256i const fourth = _mm256_subs_epu8(
+            prev3,
+            _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))
+        );
+        __m256i const must23 = _mm256_and_si256(
+            _mm256_or_si256(third, fourth),
+            _mm256_set1_epi8(static_cast<char>(0x80))
+        );
+        return _mm256_xor_si256(must23, special);
+    }
+
+    // Leads in the last three bytes whose sequence needs more bytes
+    static __m256i incomplete(__m256i input) {
+        __m256i const limits = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1,
+            static_cast<char>(0xF0 - 1),
+            static_cast<char>(0xE0 - 1),
+            static_cast<char>(0xC0 - 1)
+        );
+        return _mm256_subs_epu8(input, limits);
+    }
+
+    __m256i m_Error{_mm256_setzero_si256()};
+    __m256i m_Prior{_mm256_setzero_si256()};
+    __m256i m_PriorIncomplete{_mm256_setzero_si256()};
+};
+
+bool
+validUtf8Avx2(char const* data, std::size_t size)
+{
+    Utf8Checker checker;
+    std::size_t i = 0;
+    for (; i + kBlock <= size; i += kBlock) {
+        checker.check(load(data + i));
+    }
+    return checker.finish(data + i, size - i);
+}
+
+} // namespace
+
+TextKernels::Kernels const TextKernels::Detail::kAvx2Kernels{
+    TextKernels::Isa::Avx2,
+    findByteAvx2,
+    countByteAvx2,
+    foldCaseAvx2,
+    validUtf8Avx2
+};
+
+// End of `text_kernels_avx2.cxx'
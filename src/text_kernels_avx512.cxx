@@ -0,0 +1,417 @@
+// ============================================================================
+//
+// File:        text_kernels_avx512.cxx
+// Description: AVX-512 (F and BW) variant of the text kernels (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * text_kernels_avx512.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "text_kernels.hxx"
+
+// Standard library headers
+#include <cstddef>
+#include <cstdint>
+
+// System headers
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+// ============================================================================
+// AVX-512 Kernels Section
+// ============================================================================
+
+// Only functions local to this translation unit, see text_kernels.hxx
+namespace {
+
+constexpr std::size_t kBlock{64};
+
+// Index of the lowest set bit, the mask must not be zero
+unsigned
+lowestBit(std::uint64_t mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+}
+
+__m512i
+load(char const* data)
+{
+    return _mm512_loadu_si512(data);
+}
+
+// Lanes of the first `size' bytes, which must be less than a block. The
+// tails are loaded and stored through such masks, masked off bytes are
+// never touched.
+__mmask64
+tailMask(std::size_t size)
+{
+    return static_cast<__mmask64>((std::uint64_t{1} << size) - 1);
+}
+
+__m512i
+loadTail(char const* data, std::size_t size)
+{
+    return _mm512_maskz_loadu_epi8(tailMask(size), data);
+}
+
+std::size_t
+findByteAvx512(char const* data, std::size_t size, char byte)
+{
+    __m512i const needle = _mm512_set1_epi8(byte);
+    std::size_t i = 0;
+    for (; i + kBlock <= size; i += kBlock) {
+        __mmask64 const mask = _mm512_cmpeq_epi8_mask(load(data + i), needle);
+        if (0 != mask) {
+            return i + lowestBit(mask);
+        }
+    }
+    if (i < size) {
+        __mmask64 const mask = _mm512_mask_cmpeq_epi8_mask(
+            tailMask(size - i),
+            loadTail(data + i, size - i),
+            needle
+        );
+        if (0 != mask) {
+            return i + lowestBit(mask);
+        }
+    }
+    return size;
+}
+
+std::size_t
+countByteAvx512(char const* data, std::size_t size, char byte)
+{
+    __m512i const needle = _mm512_set1_epi8(byte);
+    __m512i const one = _mm512_set1_epi8(1);
+    __m512i const zero = _mm512_setzero_si512();
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+    while (i < size) {
+        // Byte counters, summed up before any of them can overflow
+        std::size_t blocks = (size - i + kBlock - 1) / kBlock;
+        blocks = blocks < 255 ? blocks : 255;
+        __m512i counters = zero;
+        for (std::size_t block = 0; block < blocks; ++block, i += kBlock) {
+            __mmask64 const mask = i + kBlock <= size
+                ? _mm512_cmpeq_epi8_mask(load(data + i), needle)
+                : _mm512_mask_cmpeq_epi8_mask(
+                    tailMask(size - i),
+                    loadTail(data + i, size - i),
+                    needle
+                );
+            counters = _mm512_mask_add_epi8(counters, mask, counters, one);
+        }
+        count += static_cast<std::size_t>(
+            _mm512_reduce_add_epi64(_mm512_sad_epu8(counters, zero))
+        );
+    }
+    return count;
+}
+
+__m512i
+foldBlock(__m512i text)
+{
+    __mmask64 const upper = _mm512_cmplt_epu8_mask(
+        _mm512_sub_epi8(text, _mm512_set1_epi8('A')),
+        _mm512_set1_epi8(26)
+    );
+    return _mm512_mask_add_epi8(text, upper, text, _mm512_set1_epi8(0x20));
+}
+
+void
+foldCaseAvx512(char const* data, std::size_t size, char* out)
+{
+    std::size_t i = 0;
+    for (; i + kBlock <= size; i += kBlock) {
+        _mm512_storeu_si512(out + i, foldBlock(load(data + i)));
+    }
+    if (i < size) {
+        _mm512_mask_storeu_epi8(
+            out + i,
+            tailMask(size - i),
+            foldBlock(loadTail(data + i, size - i))
+        );
+    }
+}
+
+// ----------------------------------------------------------------------------
+// UTF-8 validation
+// ----------------------------------------------------------------------------
+//
+// Same lookup algorithm as the AVX2 variant (text_kernels_avx2.cxx), over
+// 64 bytes at a time. The byte shuffles and the byte alignment work within
+// 128-bit lanes, so the previous bytes are shifted in across the lanes by
+// a permutation of 64-bit words first.
+//
+// ----------------------------------------------------------------------------
+
+// Error bits of a pair of bytes
+constexpr std::uint8_t kTooShort{1 << 0};     // Lead not followed by a
+                                              // continuation
+constexpr std::uint8_t kTooLong{1 << 1};      // ASCII followed by a
+                                              // continuation
+constexpr std::uint8_t kOverlong3{1 << 2};    // E0 80..9F
+constexpr std::uint8_t kTooLarge{1 << 3};     // F4 90..BF, F5..FF
+constexpr std::uint8_t kSurrogate{1 << 4};    // ED A0..BF
+constexpr std::uint8_t kOverlong2{1 << 5};    // C0, C1
+constexpr std::uint8_t kTooLarge1000{1 << 6}; // F5..FF 80..8F
+constexpr std::uint8_t kOverlong4{1 << 6};    // F0 80..8F
+constexpr std::uint8_t kTwoConts{1 << 7};     // Continuation after a
+                                              // continuation
+constexpr std::uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+__m512i
+table(
+    std::uint8_t e0, std::uint8_t e1, std::uint8_t e2, std::uint8_t e3,
+    std::uint8_t e4, std::uint8_t e5, std::uint8_t e6, std::uint8_t e7,
+    std::uint8_t e8, std::uint8_t e9, std::uint8_t ea, std::uint8_t eb,
+    std::uint8_t ec, std::uint8_t ed, std::uint8_t ee, std::uint8_t ef
+) {
+    return _mm512_broadcast_i32x4(_mm_setr_epi8(
+        static_cast<char>(e0), static_cast<char>(e1),
+        static_cast<char>(e2), static_cast<char>(e3),
+        static_cast<char>(e4), static_cast<char>(e5),
+        static_cast<char>(e6), static_cast<char>(e7),
+        static_cast<char>(e8), static_cast<char>(e9),
+        static_cast<char>(ea), static_cast<char>(eb),
+        static_cast<char>(ec), static_cast<char>(ed),
+        static_cast<char>(ee), static_cast<char>(ef)
+    ));
+}
+
+__m512i
+highNibbles(__m512i bytes)
+{
+    return _mm512_and_si512(
+        _mm512_srli_epi16(bytes, 4),
+        _mm512_set1_epi8(0x0F)
+    );
+}
+
+// Bytes of the input shifted by `N', the last bytes of the previous input
+// shifted in
+template <int N>
+__m512i
+previous(__m512i input, __m512i prior)
+{
+    // Last 128-bit lane of the prior input, then the first three of the
+    // input
+    __m512i const lanes = _mm512_permutex2var_epi64(
+        prior,
+        _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6),
+        input
+    );
+    return _mm512_alignr_epi8(input, lanes, 16 - N);
+}
+
+class Utf8Checker {
+public:
+    void check(__m512i input) {
+        if (0 == _mm512_movepi8_mask(input)) {
+            // A sequence left incomplete by the previous input is an error
+            m_Error = _mm512_or_si512(m_Error, m_PriorIncomplete);
+            m_PriorIncomplete = _mm512_setzero_si512();
+        } else {
+            __m512i const prev1 = previous<1>(input, m_Prior);
+            __m512i const special = specialCases(input, prev1);
+            m_Error = _mm512_or_si512(
+                m_Error,
+                multibyteLengths(input, m_Prior, special)
+            );
+            m_PriorIncomplete = incomplete(input);
+        }
+        m_Prior = input;
+    }
+
+    // Checks the input that does not fill a block, zero padded so that a
+    // sequence truncated by the end of the input is an error
+    bool finish(char const* data, std::size_t size) {
+        check(loadTail(data, size));
+        m_Error = _mm512_or_si512(m_Error, m_PriorIncomplete);
+        return 0 == _mm512_test_epi8_mask(m_Error, m_Error);
+    }
+
+private:
+    static __m512i specialCases(__m512i input, __m512i prev1) {
+        __m512i const byte1High = _mm512_shuffle_epi8(
+            table(
+                // 0_______ ASCII
+                kTooLong, kTooLong, kTooLong, kTooLong,
+                kTooLong, kTooLong, kTooLong, kTooLong,
+                // 10______ continuation
+                kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+                // 1100____ two byte lead
+                kTooShort | kOverlong2,
+                // 1101____ two byte lead
+                kTooShort,
+                // 1110____ three byte lead
+                kTooShort | kOverlong3 | kSurrogate,
+                // 1111____ four byte lead
+                kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+            ),
+            highNibbles(prev1)
+        );
+        __m512i const byte1Low = _mm512_shuffle_epi8(
+            table(
+                // ____0000
+                kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+                // ____0001
+                kCarry | kOverlong2,
+                // ____001_
+                kCarry,
+                kCarry,
+                // ____0100
+                kCarry | kTooLarge,
+                // ____0101 to ____1100
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000,
+                // ____1101
+                kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+                // ____111_
+                kCarry | kTooLarge | kTooLarge1000,
+                kCarry | kTooLarge | kTooLarge1000
+            ),
+            _mm512_and_si512(prev1, _mm512_set1_epi8(0x0F))
+        );
+        __m512i const byte2High = _mm512_shuffle_epi8(
+            table(
+                // 0_______ ASCII
+                kTooShort, kTooShort, kTooShort, kTooShort,
+                kTooShort, kTooShort, kTooShort, kTooShort,
+                // 1000____
+                kTooLong | kOverlong2 | kTwoConts | kOverlong3
+                    | kTooLarge1000 | kOverlong4,
+                // 1001____
+                kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+                // 101_____
+                kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+                kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+                // 11______ lead
+                kTooShort, kTooShort, kTooShort, kTooShort
+            ),
+            highNibbles(input)
+        );
+        return _mm512_and_si512(
+            _mm512_and_si512(byte1High, byte1Low),
+            byte2High
+        );
+    }
+
+    // Bytes two and three after a three or four byte lead must be
+    // continuations, which `specialCases' reports as two in a row
+    static __m512i multibyteLengths(
+        __m512i input,
+        __m512i prior,
+        __m512i special
+    ) {
+        __m512i const prev2 = previous<2>(input, prior);
+        __m512i const prev3 = previous<3>(input, prior);
+        // Only 111_____ and 1111____ keep the high bit
+        __m512i const third = _mm512_subs_epu8(
+            prev2,
+            _mm512_set1_epi8(static_cast<char>(0xE0 - 0x80))
+        );
+        __m512i const fourth = _mm512_subs_epu8(
+            prev3,
+            _mm512_set1_epi8(static_cast<char>(0xF0 - 0x80))
+        );
+        __m512i const must23 = _mm512_and_si512(
+            _mm512_or_si512(third, fourth),
+            _mm512_set1_epi8(static_cast<char>(0x80))
+        );
+        return _mm512_xor_si512(must23, special);
+    }
+
+    // Leads in the last three bytes whose sequence needs more bytes
+    static __m512i incomplete(__m512i input) {
+        alignas(64) static constexpr unsigned char kLimits[kBlock] = {
+            255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255,
+            0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+        };
+        return _mm512_subs_epu8(input, _mm512_load_si512(kLimits));
+    }
+
+    __m512i m_Error{_mm512_setzero_si512()};
+    __m512i m_Prior{_mm512_setzero_si512()};
+    __m512i m_PriorIncomplete{_mm512_setzero_si512()};
+};
+
+bool
+validUtf8Avx512(char const* data, std::size_t size)
+{
+    Utf8Checker checker;
+    std::size_t i = 0;
+    for (; i + kBlock <= size; i += kBlock) {
+        checker.check(load(data + i));
+    }
+    return checker.finish(data + i, size - i);
+}
+
+} // namespace
+
+TextKernels::Kernels const TextKernels::Detail::kAvx512Kernels{
+    TextKernels::Isa::Avx512,
+    findByteAvx512,
+    countByteAvx512,
+    foldCaseAvx512,
+    validUtf8Avx512
+};
+
+// End of `text_kernels_avx512.cxx'
@@ -0,0 +1,223 @@
+// ============================================================================
+//
+// File:        text_kernels_sse2.cxx
+// Description: SSE2 variant of the text kernels (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * text_kernels_sse2.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "text_kernels.hxx"
+
+// Standard library headers
+#include <cstddef>
+
+// System headers
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+// ============================================================================
+// SSE2 Kernels Section
+// ============================================================================
+
+// Only functions local to this translation unit, see text_kernels.hxx
+namespace {
+
+constexpr std::size_t kBlock{16};
+
+// Index of the lowest set bit, the mask must not be zero
+unsigned
+lowestBit(unsigned mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+__m128i
+load(char const* data)
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+}
+
+std::size_t
+findByteSse2(char const* data, std::size_t size, char byte)
+{
+    __m128i const needle = _mm_set1_epi8(byte);
+    std::size_t i = 0;
+
+    // Four blocks per test of the mask
+    for (; i + 4 * kBlock <= size; i += 4 * kBlock) {
+        __m128i const a = _mm_cmpeq_epi8(load(data + i), needle);
+        __m128i const b = _mm_cmpeq_epi8(load(data + i + kBlock), needle);
+        __m128i const c = _mm_cmpeq_epi8(load(data + i + 2 * kBlock), needle);
+        __m128i const d = _mm_cmpeq_epi8(load(data + i + 3 * kBlock), needle);
+        __m128i const any =
+            _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (0 != _mm_movemask_epi8(any)) {
+            break;  // Found by the block loop below
+        }
+    }
+    for (; i + kBlock <= size; i += kBlock) {
+        unsigned const mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(load(data + i), needle))
+        );
+        if (0 != mask) {
+            return i + lowestBit(mask);
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == byte) {
+            return i;
+        }
+    }
+    return size;
+}
+
+std::size_t
+countByteSse2(char const* data, std::size_t size, char byte)
+{
+    __m128i const needle = _mm_set1_epi8(byte);
+    __m128i const zero = _mm_setzero_si128();
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+    while (i + kBlock <= size) {
+        // Byte counters, summed up before any of them can overflow
+        std::size_t blocks = (size - i) / kBlock;
+        blocks = blocks < 255 ? blocks : 255;
+        __m128i counters = zero;
+        for (std::size_t block = 0; block < blocks; ++block, i += kBlock) {
+            counters = _mm_sub_epi8(
+                counters,
+                _mm_cmpeq_epi8(load(data + i), needle)
+            );
+        }
+        __m128i const sums = _mm_sad_epu8(counters, zero);
+        count += static_cast<std::size_t>(_mm_cvtsi128_si64(sums))
+            + static_cast<std::size_t>(
+                _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums))
+            );
+    }
+    for (; i < size; ++i) {
+        count += data[i] == byte ? 1 : 0;
+    }
+    return count;
+}
+
+void
+foldCaseSse2(char const* data, std::size_t size, char* out)
+{
+    // 'A' to 'Z' moved to the bottom of the signed byte range
+    __m128i const shift = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+    __m128i const bound = _mm_set1_epi8(static_cast<char>(-128 + 26));
+    __m128i const lower = _mm_set1_epi8(0x20);
+    std::size_t i = 0;
+
+    for (; i + kBlock <= size; i += kBlock) {
+        __m128i const text = load(data + i);
+        __m128i const upper =
+            _mm_cmplt_epi8(_mm_add_epi8(text, shift), bound);
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(out + i),
+            _mm_or_si128(text, _mm_and_si128(upper, lower))
+        );
+    }
+    for (; i < size; ++i) {
+        char const c = data[i];
+        out[i] = ('A' <= c && c <= 'Z')
+            ? static_cast<char>(c + ('a' - 'A'))
+            : c;
+    }
+}
+
+// ASCII blocks are skipped sixteen bytes at a time, the sequences of the
+// other blocks are checked one by one (SSE2 has no byte shuffle for the
+// table lookups of the wider variants)
+bool
+validUtf8Sse2(char const* data, std::size_t size)
+{
+    auto const* text = reinterpret_cast<unsigned char const*>(data);
+    std::size_t i = 0;
+
+    while (i < size) {
+        std::size_t end = size;
+        if (i + kBlock <= size) {
+            unsigned const mask =
+                static_cast<unsigned>(_mm_movemask_epi8(load(data + i)));
+            if (0 == mask) {
+                i += kBlock;
+                continue;
+            }
+            end = i + kBlock;
+            i += lowestBit(mask);
+        }
+        // Sequences starting in the block, the last one may run past it
+        while (i < end) {
+            if (text[i] < 0x80) {
+                ++i;
+                continue;
+            }
+            std::size_t const length =
+                TextKernels::Detail::utf8SequenceLength(text + i, size - i);
+            if (0 == length) {
+                return false;
+            }
+            i += length;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TextKernels::Kernels const TextKernels::Detail::kSse2Kernels{
+    TextKernels::Isa::Sse2,
+    findByteSse2,
+    countByteSse2,
+    foldCaseSse2,
+    validUtf8Sse2
+};
+
+// End of `text_kernels_sse2.cxx'
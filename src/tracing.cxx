@@ -0,0 +1,418 @@
+// ============================================================================
+//
+// File:        tracing.cxx
+// Description: Low-overhead phase tracing (definitions)
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * tracing.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "tracing.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+
+// System headers
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+// Initialize the epoch before the objects of the other translation units
+#pragma warning(disable: 4073)
+#pragma init_seg(lib)
+#define TRACING_EARLY_INIT
+#else
+#define TRACING_EARLY_INIT __attribute__((init_priority(101)))
+#endif
+
+
+// ============================================================================
+// Local Definitions Section
+// ============================================================================
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    const Clock::time_point kEpoch TRACING_EARLY_INIT = Clock::now();
+
+    constexpr std::string_view kTraceOptionPrefix{"--trace="};
+
+    // Single producer ring of the events of one thread. The owning thread
+    // publishes each event with a release store of the head, readers
+    // (running only when the producers are quiet) acquire the head and take
+    // the newest `capacity' events.
+    struct ThreadRing {
+        explicit ThreadRing(std::uint32_t thread_id)
+            : thread{thread_id},
+            slots{new Tracing::Event[Tracing::DEFAULT_RING_CAPACITY]}
+        { }
+
+        void push(Tracing::Event const& event) {
+            std::uint64_t position = head.load(std::memory_order_relaxed);
+            slots[position & (Tracing::DEFAULT_RING_CAPACITY - 1)] = event;
+            head.store(position + 1, std::memory_order_release);
+        }
+
+        std::uint32_t const thread;
+        std::unique_ptr<Tracing::Event[]> const slots;
+        std::atomic<std::uint64_t> head{0};
+    };
+
+    static_assert(
+        (Tracing::DEFAULT_RING_CAPACITY
+            & (Tracing::DEFAULT_RING_CAPACITY - 1)) == 0,
+        "Ring capacity must be a power of two"
+    );
+
+    // Rings outlive their threads, so the events of finished threads are
+    // still collected
+    struct RingRegistry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadRing>> rings;
+    };
+
+    RingRegistry& registry() {
+        static RingRegistry instance;
+        return instance;
+    }
+
+    ThreadRing& threadRing() {
+        thread_local ThreadRing* ring = nullptr;
+        if (nullptr == ring) {
+            auto& reg = registry();
+            std::lock_guard<std::mutex> lock{reg.mutex};
+            reg.rings.push_back(std::make_unique<ThreadRing>(
+                static_cast<std::uint32_t>(reg.rings.size() + 1)
+            ));
+            ring = reg.rings.back().get();
+        }
+        return *ring;
+    }
+
+    int processId() {
+#if defined(_WIN32)
+        return _getpid();
+#else
+        return static_cast<int>(getpid());
+#endif
+    }
+
+    // Nanoseconds as microseconds with three decimals
+    void writeMicroseconds(OutputSinks::OutputSink& sink, Tracing::Timestamp ns) {
+        char fraction[4] = {
+            static_cast<char>('0' + ns / 100 % 10),
+            static_cast<char>('0' + ns / 10 % 10),
+            static_cast<char>('0' + ns % 10),
+            '\0'
+        };
+        sink << ns / 1000 << '.' << std::string_view{fraction, 3};
+    }
+
+    void writeJsonString(OutputSinks::OutputSink& sink, std::string_view text) {
+        sink << '"';
+        for (char c : text) {
+            if ('"' == c || '\\' == c) {
+                sink << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                sink << ' ';
+            } else {
+                sink << c;
+            }
+        }
+        sink << '"';
+    }
+
+};
+
+
+// ============================================================================
+// Recording Section
+// ============================================================================
+
+void Tracing::setEnabled(bool enabled)
+{
+    Detail::g_Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+Tracing::Timestamp Tracing::now()
+{
+    return static_cast<Timestamp>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - kEpoch
+        ).count()
+    );
+}
+
+void Tracing::record(char const* name, Timestamp start, Timestamp end)
+{
+    threadRing().push(Event{name, start, end > start ? end - start : 0});
+}
+
+std::vector<Tracing::CollectedEvent> Tracing::collect(std::size_t* dropped)
+{
+    std::vector<CollectedEvent> events;
+    std::size_t overwritten = 0;
+
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock{reg.mutex};
+    for (auto const& ring : reg.rings) {
+        std::uint64_t head = ring->head.load(std::memory_order_acquire);
+        std::uint64_t first = head > DEFAULT_RING_CAPACITY
+            ? head - DEFAULT_RING_CAPACITY
+            : 0;
+        overwritten += static_cast<std::size_t>(first);
+        for (std::uint64_t i = first; i < head; ++i) {
+            events.push_back(CollectedEvent{
+                ring->slots[i & (DEFAULT_RING_CAPACITY - 1)],
+                ring->thread
+            });
+        }
+    }
+
+    std::stable_sort(
+        events.begin(),
+        events.end(),
+        [](CollectedEvent const& a, CollectedEvent const& b) {
+            return a.event.start < b.event.start;
+        }
+    );
+
+    if (nullptr != dropped) {
+        *dropped = overwritten;
+    }
+
+    return events;
+}
+
+void Tracing::reset()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock{reg.mutex};
+    for (auto const& ring : reg.rings) {
+        ring->head.store(0, std::memory_order_release);
+    }
+}
+
+
+// ============================================================================
+// Reporting Section
+// ============================================================================
+
+void Tracing::writeChromeTrace(
+    OutputSinks::OutputSink& sink,
+    std::vector<CollectedEvent> const& events,
+    std::size_t dropped
+) {
+    int const pid = processId();
+
+    sink << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        auto const& item = events[i];
+        sink << (0 == i ? "\n" : ",\n") << "{\"name\":";
+        writeJsonString(sink, item.event.name);
+        sink << ",\"cat\":\"cli\",\"ph\":\"X\",\"pid\":" << pid
+            << ",\"tid\":" << item.thread << ",\"ts\":";
+        writeMicroseconds(sink, item.event.start);
+        sink << ",\"dur\":";
+        writeMicroseconds(sink, item.event.duration);
+        sink << '}';
+    }
+    sink << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":"
+        << dropped << "}}\n";
+}
+
+void Tracing::writeSummary(
+    OutputSinks::OutputSink& sink,
+    std::vector<CollectedEvent> const& events,
+    std::size_t dropped
+) {
+    struct Totals {
+        std::size_t count{0};
+        Timestamp total{0};
+        Timestamp max{0};
+    };
+
+    std::map<std::string_view, Totals> byName;
+    for (auto const& item : events) {
+        auto& totals = byName[item.event.name];
+        ++totals.count;
+        totals.total += item.event.duration;
+        totals.max = std::max(totals.max, item.event.duration);
+    }
+
+    std::vector<std::pair<std::string_view, Totals>> rows(
+        byName.begin(),
+        byName.end()
+    );
+    std::stable_sort(
+        rows.begin(),
+        rows.end(),
+        [](auto const& a, auto const& b) {
+            return a.second.total > b.second.total;
+        }
+    );
+
+    std::size_t nameWidth = 5;
+    for (auto const& row : rows) {
+        nameWidth = std::max(nameWidth, row.first.size());
+    }
+
+    std::ostringstream table;
+    table << std::left << std::setw(static_cast<int>(nameWidth)) << "phase"
+        << std::right << std::setw(8) << "count"
+        << std::setw(14) << "total [us]"
+        << std::setw(14) << "mean [us]"
+        << std::setw(14) << "max [us]" << "\n";
+    table << std::fixed << std::setprecision(3);
+    for (auto const& [name, totals] : rows) {
+        table << std::left << std::setw(static_cast<int>(nameWidth)) << name
+            << std::right << std::setw(8) << totals.count
+            << std::setw(14) << totals.total / 1000.0
+            << std::setw(14) << totals.total / 1000.0 / totals.count
+            << std::setw(14) << totals.max / 1000.0 << "\n";
+    }
+    if (0 != dropped) {
+        table << dropped << " older events were overwritten\n";
+    }
+
+    sink << table.str();
+}
+
+
+// ============================================================================
+// Configuration Section
+// ============================================================================
+
+std::string Tracing::traceFileFromCommandLine(
+    int& argc,
+    char** argv,
+    char const* env_var
+) {
+    std::string traceFile;
+    bool found = false;
+
+    int kept = 1;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (0 == arg.compare(0, kTraceOptionPrefix.size(), kTraceOptionPrefix)) {
+            traceFile = std::string {arg.substr(kTraceOptionPrefix.size())};
+            found = true;
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    if (kept < argc) {
+        argv[kept] = nullptr;
+    }
+    argc = kept;
+
+    if (!found && nullptr != env_var) {
+        char const* value = std::getenv(env_var);
+        if (nullptr != value) {
+            traceFile = value;
+        }
+    }
+
+    return traceFile;
+}
+
+
+// ============================================================================
+// Session Definition Section
+// ============================================================================
+
+Tracing::Session::~Session()
+{
+    finish();
+}
+
+bool Tracing::Session::start(
+    std::string trace_file,
+    OutputSinks::OutputSink& summary
+) {
+    if (!kCompiledIn || trace_file.empty()) {
+        return false;
+    }
+
+    m_TraceFile = std::move(trace_file);
+    m_Summary = &summary;
+    setEnabled(true);
+
+    return true;
+}
+
+bool Tracing::Session::finish()
+{
+    if (!active()) {
+        return true;
+    }
+    setEnabled(false);
+
+    std::size_t dropped = 0;
+    auto events = collect(&dropped);
+
+    OutputSinks::MappedFileSink file{m_TraceFile};
+    bool written = file.good();
+    if (written) {
+        writeChromeTrace(file, events, dropped);
+        written = file.close();
+    }
+
+    writeSummary(*m_Summary, events, dropped);
+    if (!written) {
+        *m_Summary << "tracing: cannot write " << m_TraceFile << '\n';
+    }
+    m_Summary->flush();
+    m_Summary = nullptr;
+
+    return written;
+}
+
+// End of `tracing.cxx'
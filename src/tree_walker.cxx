@@ -0,0 +1,284 @@
+// ============================================================================
+//
+// File:        tree_walker.cxx
+// Description: Parallel directory tree traversal (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * tree_walker.cxx: created.
+// * tree_walker.cxx: the jobs are clamped to `maxJobs', and a walk goes on
+//   with the threads started if starting one fails.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "tree_walker.hxx"
+
+// Project headers
+#include "tracing.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+
+// ============================================================================
+// Work Stealing Section
+// ============================================================================
+
+namespace {
+
+// Failed attempts to find work before an idle worker starts sleeping
+constexpr unsigned kIdleSpins{64};
+
+// Most worker threads per CPU
+constexpr unsigned kJobsPerCpu{8};
+
+// Directories waiting to be read by a worker, a cache line apart from the
+// queues of the other workers
+struct alignas(64) WorkQueue {
+    std::mutex mutex;
+    std::deque<std::filesystem::path> directories;
+};
+
+// ----------------------------------------------------------------------------
+// Walk
+// ----------------------------------------------------------------------------
+//
+// Description: Shared state of the workers of a walk. A directory counts as
+//              pending from the moment it is queued until it has been read,
+//              and its subdirectories are queued while it is still pending,
+//              so the walk is over once no directory is pending.
+//
+// ----------------------------------------------------------------------------
+class Walk {
+public:
+    explicit Walk(unsigned jobs)
+        : m_Jobs{jobs}, m_Queues{new WorkQueue[jobs]}
+    { }
+
+    void push(unsigned worker, std::filesystem::path directory) {
+        m_Pending.fetch_add(1);
+        WorkQueue& queue = m_Queues[worker];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        queue.directories.push_back(std::move(directory));
+    }
+
+    // Reads directories until none is pending
+    void run(
+        unsigned worker,
+        TreeWalker::FileVisitor& visitor,
+        TreeWalker::WalkStats& stats
+    ) {
+        TRACE_SCOPE("walkWorker");
+        unsigned idle = 0;
+        for (;;) {
+            std::filesystem::path directory;
+            if (take(worker, directory)) {
+                idle = 0;
+                read(worker, directory, visitor, stats);
+                m_Pending.fetch_sub(1);
+                continue;
+            }
+            if (0 == m_Pending.load()) {
+                return;
+            }
+            // Others are still reading directories that may hold more work
+            if (++idle < kIdleSpins) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds{50});
+            }
+        }
+    }
+
+private:
+    // Newest directory of the own queue, or else the oldest one of another
+    bool take(unsigned worker, std::filesystem::path& directory) {
+        {
+            WorkQueue& own = m_Queues[worker];
+            std::lock_guard<std::mutex> lock{own.mutex};
+            if (!own.directories.empty()) {
+                directory = std::move(own.directories.back());
+                own.directories.pop_back();
+                return true;
+            }
+        }
+        for (unsigned i = 1; i < m_Jobs; ++i) {
+            WorkQueue& victim = m_Queues[(worker + i) % m_Jobs];
+            std::lock_guard<std::mutex> lock{victim.mutex};
+            if (!victim.directories.empty()) {
+                directory = std::move(victim.directories.front());
+                victim.directories.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void read(
+        unsigned worker,
+        std::filesystem::path const& directory,
+        TreeWalker::FileVisitor& visitor,
+        TreeWalker::WalkStats& stats
+    ) {
+        std::error_code error;
+        std::filesystem::directory_iterator entries{directory, error};
+        std::filesystem::directory_iterator const end;
+        if (!error) {
+            ++stats.directories;
+        }
+
+        for (; !error && entries != end; entries.increment(error)) {
+            auto const& entry = *entries;
+            // The types come with the directory entries on most file
+            // systems, no status call is made for them
+            std::error_code typeError;
+            if (!entry.is_symlink(typeError)
+                && entry.is_directory(typeError)
+            ) {
+                push(worker, entry.path());
+            } else {
+                ++stats.files;
+                visitor.visit(entry);
+            }
+        }
+
+        if (error) {
+            stats.errors.push_back(TreeWalker::WalkError{directory, error});
+        }
+    }
+
+    unsigned m_Jobs;
+    std::unique_ptr<WorkQueue[]> m_Queues;
+    std::atomic<std::size_t> m_Pending{0};
+};
+
+} // namespace
+
+
+// ============================================================================
+// Tree Walker Section
+// ============================================================================
+
+unsigned
+TreeWalker::defaultJobs()
+{
+    unsigned const jobs = std::thread::hardware_concurrency();
+    return 0 == jobs ? 1 : jobs;
+}
+
+unsigned
+TreeWalker::maxJobs()
+{
+    return kJobsPerCpu * defaultJobs();
+}
+
+TreeWalker::WalkStats
+TreeWalker::walk(
+    ArgvParser::ArgSpan roots,
+    FileVisitor& visitor,
+    unsigned jobs
+) {
+    TRACE_SCOPE("walk");
+    if (0 == jobs) {
+        jobs = defaultJobs();
+    }
+    jobs = std::min(jobs, maxJobs());
+
+    // Per-worker visitors and totals, merged once the workers are done
+    std::vector<std::unique_ptr<FileVisitor>> visitors;
+    std::vector<WalkStats> stats(jobs);
+    for (unsigned worker = 0; worker < jobs; ++worker) {
+        visitors.push_back(visitor.fork());
+    }
+
+    // Roots are spread over the workers, symbolic links to directories
+    // are followed for them
+    Walk state{jobs};
+    for (std::size_t i = 0; i < roots.size(); ++i) {
+        std::filesystem::path root{roots[i]};
+        std::error_code error;
+        std::filesystem::directory_entry entry{root, error};
+        if (!error && !entry.exists(error)) {
+            error = std::make_error_code(std::errc::no_such_file_or_directory);
+        }
+        if (error) {
+            stats.front().errors.push_back(WalkError{root, error});
+        } else if (entry.is_directory(error)) {
+            state.push(static_cast<unsigned>(i % jobs), root);
+        } else {
+            ++stats.front().files;
+            visitors.front()->visit(entry);
+        }
+    }
+
+    // Workers steal from every queue, so the directories queued for
+    // workers that could not be started are read by the others
+    std::vector<std::thread> threads;
+    threads.reserve(jobs - 1);
+    for (unsigned worker = 1; worker < jobs; ++worker) {
+        try {
+            threads.emplace_back([&, worker] {
+                state.run(worker, *visitors[worker], stats[worker]);
+            });
+        } catch (std::system_error const&) {
+            break;
+        }
+    }
+    state.run(0, *visitors.front(), stats.front());
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    WalkStats total;
+    for (unsigned worker = 0; worker < jobs; ++worker) {
+        visitor.merge(*visitors[worker]);
+        total.directories += stats[worker].directories;
+        total.files += stats[worker].files;
+        for (auto& error : stats[worker].errors) {
+            total.errors.push_back(std::move(error));
+        }
+    }
+
+    return total;
+}
+
+// End of `tree_walker.cxx'
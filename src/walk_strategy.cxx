@@ -0,0 +1,283 @@
+// ============================================================================
+//
+// File:        walk_strategy.cxx
+// Description: Strategy listing the files under its directory arguments,
+//              walked on a pool of worker threads (definitions)
+//
+// This file is part of `C++ Playground'.
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * walk_strategy.cxx: created.
+// * walk_strategy.cxx: more jobs than `TreeWalker::maxJobs' are rejected.
+// * walk_strategy.cxx: unsorted listings are written as the files are found,
+//   through a buffer per worker.
+// * walk_strategy.cxx: the listing buffers are taken from the arena.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Related header
+#include "walk_strategy.hxx"
+
+// Project headers
+#include "tree_walker.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+
+// ============================================================================
+// Listing Visitor Section
+// ============================================================================
+
+namespace {
+
+// Listing lines a worker gathers before writing them out
+constexpr std::size_t kListingBufferSize{8 * 1024};
+
+struct ListedFile {
+    std::string path;
+    std::uintmax_t size;
+};
+
+// ----------------------------------------------------------------------------
+// ListingVisitor
+// ----------------------------------------------------------------------------
+//
+// Description: Lists the paths and the sizes of the visited files. Sizes are
+//              those of regular files (symbolic links to them included), zero
+//              for anything else.
+//
+//              Unless sorted, each worker formats its lines into a buffer of
+//              its own and writes the buffer to the output under the output
+//              lock once it is full, and once more when the worker is merged,
+//              so lines are never split. The buffers are taken from `memory'
+//              by `fork', on the calling thread, and never grow, so workers
+//              allocate nothing for them. A sorted listing is collected and
+//              printed by the caller once the walk is over.
+//
+// ----------------------------------------------------------------------------
+class ListingVisitor : public TreeWalker::FileVisitor {
+public:
+    ListingVisitor(
+        OutputSinks::OutputSink& out,
+        std::mutex& outLock,
+        bool sorted,
+        std::pmr::memory_resource& memory
+    ) : m_Out{out}, m_OutLock{outLock}, m_Sorted{sorted}, m_Buffer{&memory}
+    { }
+
+    std::unique_ptr<TreeWalker::FileVisitor> fork() const override {
+        auto fork = std::make_unique<ListingVisitor>(
+            m_Out,
+            m_OutLock,
+            m_Sorted,
+            *m_Buffer.get_allocator().resource()
+        );
+        if (!m_Sorted) {
+            fork->m_Buffer.reserve(kListingBufferSize);
+        }
+        return fork;
+    }
+
+    void visit(std::filesystem::directory_entry const& entry) override {
+        std::error_code error;
+        std::uintmax_t size = 0;
+        if (entry.is_regular_file(error)) {
+            size = entry.file_size(error);
+            if (error) {
+                size = 0;
+            }
+        }
+        m_Total += size;
+
+        if (m_Sorted) {
+            m_Files.push_back(ListedFile{entry.path().string(), size});
+        } else {
+            list(size, entry.path());
+        }
+    }
+
+    void merge(TreeWalker::FileVisitor& fork) override {
+        auto& other = static_cast<ListingVisitor&>(fork);
+        other.flush();
+        m_Total += other.m_Total;
+
+        auto& files = other.m_Files;
+        if (m_Files.empty()) {
+            m_Files.swap(files);
+            return;
+        }
+        m_Files.insert(
+            m_Files.end(),
+            std::make_move_iterator(files.begin()),
+            std::make_move_iterator(files.end())
+        );
+        files.clear();
+    }
+
+    // Files collected by a sorted listing
+    std::vector<ListedFile>& files() {
+        return m_Files;
+    }
+
+    std::uintmax_t total() const {
+        return m_Total;
+    }
+
+private:
+    void list(std::uintmax_t size, std::filesystem::path const& path) {
+#if defined(_WIN32)
+        std::string const name = path.string();
+#else
+        std::string const& name = path.native();
+#endif
+        char digits[24];
+        auto const result = std::to_chars(
+            digits,
+            digits + sizeof(digits),
+            size
+        );
+        std::string_view const sizeText{
+            digits,
+            static_cast<std::size_t>(result.ptr - digits)
+        };
+
+        std::size_t const length = sizeText.size() + name.size() + 2;
+        if (m_Buffer.size() + length > m_Buffer.capacity()) {
+            flush();
+        }
+        if (length > m_Buffer.capacity()) {
+            std::lock_guard<std::mutex> lock{m_OutLock};
+            m_Out << sizeText << ' ' << std::string_view{name} << '\n';
+            return;
+        }
+        m_Buffer.append(sizeText).append(1, ' ').append(name).append(1, '\n');
+    }
+
+    void flush() {
+        if (m_Buffer.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock{m_OutLock};
+        m_Out << std::string_view{m_Buffer};
+        m_Buffer.clear();
+    }
+
+    OutputSinks::OutputSink& m_Out;
+    std::mutex& m_OutLock;
+    bool m_Sorted;
+    std::uintmax_t m_Total{0};
+    std::pmr::string m_Buffer;
+    std::vector<ListedFile> m_Files;
+};
+
+// Parses a number of worker threads from one to `TreeWalker::maxJobs()',
+// zero (the default) if empty
+bool parseJobs(std::string_view text, unsigned& jobs)
+{
+    jobs = 0;
+    if (text.empty()) {
+        return true;
+    }
+
+    auto const last = text.data() + text.size();
+    auto const result = std::from_chars(text.data(), last, jobs);
+
+    return result.ec == std::errc{} && result.ptr == last
+        && 0 < jobs && jobs <= TreeWalker::maxJobs();
+}
+
+} // namespace
+
+
+// ============================================================================
+// Strategy Definition Section
+// ============================================================================
+
+int
+WalkStrategy::operator()(CliActions::ActionContext const& action) const
+{
+    unsigned jobs;
+    if (!parseJobs(m_Jobs, jobs)) {
+        action.err() << action.execName()
+            << ": ERROR: invalid number of jobs '" << m_Jobs << "'\n";
+        return EXIT_FAILURE;
+    }
+
+    static char const* const kCurrentDirectory[] = {"."};
+    ArgvParser::ArgSpan roots = m_Roots;
+    if (roots.empty()) {
+        roots = ArgvParser::ArgSpan{kCurrentDirectory, 1};
+    }
+
+    std::mutex outLock;
+    ListingVisitor listing{action.out(), outLock, m_Sorted, action.arena()};
+    TreeWalker::WalkStats const stats = TreeWalker::walk(roots, listing, jobs);
+
+    if (m_Sorted) {
+        auto& files = listing.files();
+        std::sort(
+            files.begin(),
+            files.end(),
+            [](ListedFile const& a, ListedFile const& b) {
+                return a.path < b.path;
+            }
+        );
+        for (auto const& file : files) {
+            action.out() << file.size << ' ' << file.path << '\n';
+        }
+    }
+    action.out() << listing.total() << " total\n";
+
+    for (auto const& error : stats.errors) {
+        action.err() << action.execName() << ": " << error.path.string()
+            << ": " << error.error.message() << '\n';
+    }
+
+    return stats.errors.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// End of `walk_strategy.cxx'
@@ -0,0 +1,233 @@
+// ============================================================================
+//
+// File:        action_registry_test.cxx
+// Description: Unit tests for the compile-time action registry
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * action_registry_test.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "action_registry.hxx"
+#include "cli_actions.hxx"
+#include "output_sinks.hxx"
+
+// Standard library headers
+#include <cstdlib>
+#include <memory_resource>
+#include <string_view>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Strategy derived from `BaseStrategy', writes its name and returns the
+// status it was built with
+class NamedStrategy : public CliActions::BaseStrategy {
+public:
+    NamedStrategy(std::string_view name, int status)
+        : m_Name{name}, m_Status{status}
+    { }
+
+    int operator()(CliActions::ActionContext const& action) const override {
+        action.out() << action.execName() << ": " << m_Name << '\n';
+        return m_Status;
+    }
+
+private:
+    std::string_view m_Name;
+    int m_Status;
+};
+
+// Second strategy type derived from `BaseStrategy', writes to the error sink
+class FailingStrategy : public CliActions::BaseStrategy {
+public:
+    int operator()(CliActions::ActionContext const& action) const override {
+        action.err() << action.execName() << ": failed\n";
+        return 3;
+    }
+};
+
+// Plain callable, not derived from `BaseStrategy'
+struct CallableStrategy {
+    int status;
+
+    int operator()(CliActions::ActionContext const& action) const {
+        action.out() << "callable\n";
+        return status;
+    }
+};
+
+// Strategy checking the memory arena it is handed
+struct ArenaStrategy {
+    std::pmr::memory_resource const* expected;
+
+    int operator()(CliActions::ActionContext const& action) const {
+        return &action.arena() == expected ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+};
+
+using TestAction = CliActions::StaticCliAction<
+    NamedStrategy,
+    FailingStrategy,
+    CallableStrategy,
+    ArenaStrategy
+>;
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// StaticCliActionTest
+// ----------------------------------------------------------------------------
+//
+// Description: The action runs exactly the strategy it holds, with its own
+//              context, and returns the status of the strategy.
+//
+// ----------------------------------------------------------------------------
+
+// Case: RunsSelectedStrategy -------------------------------------------------
+TEST(StaticCliActionTest, RunsSelectedStrategy) {
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+
+  TestAction named{"app", NamedStrategy{"named", EXIT_SUCCESS}, out, err};
+  EXPECT_EQ(named.index(), 0u);
+  EXPECT_EQ(named.execute(), EXIT_SUCCESS);
+  EXPECT_EQ(out.view(), "app: named\n");
+  EXPECT_EQ(err.view(), "");
+
+  out.clear();
+  TestAction failing{"app", FailingStrategy{}, out, err};
+  EXPECT_EQ(failing.index(), 1u);
+  EXPECT_EQ(failing.execute(), 3);
+  EXPECT_EQ(out.view(), "");
+  EXPECT_EQ(err.view(), "app: failed\n");
+}
+
+// Case: PassesStatusThrough --------------------------------------------------
+TEST(StaticCliActionTest, PassesStatusThrough) {
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+
+  for (int status : {EXIT_SUCCESS, EXIT_FAILURE, 2, 127, -1}) {
+    SCOPED_TRACE(status);
+    EXPECT_EQ(
+      TestAction("app", NamedStrategy{"named", status}, out, err).execute(),
+      status
+    );
+    EXPECT_EQ(
+      TestAction("app", CallableStrategy{status}, out, err).execute(),
+      status
+    );
+  }
+}
+
+// Case: DispatchesPlainCallables ---------------------------------------------
+TEST(StaticCliActionTest, DispatchesPlainCallables) {
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+
+  TestAction callable{"app", CallableStrategy{7}, out, err};
+  EXPECT_EQ(callable.index(), 2u);
+  EXPECT_EQ(callable.execute(), 7);
+  EXPECT_EQ(out.view(), "callable\n");
+
+  std::pmr::monotonic_buffer_resource arena;
+  TestAction checked{"app", ArenaStrategy{&arena}, out, err, arena};
+  EXPECT_EQ(checked.index(), 3u);
+  EXPECT_EQ(checked.execute(), EXIT_SUCCESS);
+}
+
+// Case: SingleStrategy -------------------------------------------------------
+TEST(StaticCliActionTest, SingleStrategy) {
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+
+  CliActions::StaticCliAction<CallableStrategy> action{
+    "app",
+    CallableStrategy{5},
+    out,
+    err
+  };
+  EXPECT_EQ(action.index(), 0u);
+  EXPECT_EQ(action.execute(), 5);
+  EXPECT_EQ(out.view(), "callable\n");
+}
+
+// ----------------------------------------------------------------------------
+// ExecuteStaticTest
+// ----------------------------------------------------------------------------
+//
+// Description: A strategy chosen at compile time runs with the given context
+//              and returns its status.
+//
+// ----------------------------------------------------------------------------
+
+// Case: BaseStrategyAndCallable ----------------------------------------------
+TEST(ExecuteStaticTest, BaseStrategyAndCallable) {
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+
+  EXPECT_EQ(
+    CliActions::executeStatic("tool", NamedStrategy{"named", 4}, out, err),
+    4
+  );
+  EXPECT_EQ(
+    CliActions::executeStatic("tool", FailingStrategy{}, out, err),
+    3
+  );
+  EXPECT_EQ(
+    CliActions::executeStatic("tool", CallableStrategy{6}, out, err),
+    6
+  );
+  EXPECT_EQ(out.view(), "tool: named\ncallable\n");
+  EXPECT_EQ(err.view(), "tool: failed\n");
+
+  std::pmr::monotonic_buffer_resource arena;
+  EXPECT_EQ(
+    CliActions::executeStatic("tool", ArenaStrategy{&arena}, out, err, arena),
+    EXIT_SUCCESS
+  );
+}
+
+
+// End of `action_registry_test.cxx'
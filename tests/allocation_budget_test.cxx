@@ -0,0 +1,462 @@
+// ============================================================================
+//
+// File:        allocation_budget_test.cxx
+// Description: Counts the heap allocations of the program actions against a
+//              budget. Replaces the global `operator new', so it must stay a
+//              test executable of its own
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * allocation_budget_test.cxx: created.
+// * allocation_budget_test.cxx: added the budgets of the input and the walk
+//   strategies, which take their scratch memory from the arena.
+// * allocation_budget_test.cxx: the arena action views its strategy.
+// * allocation_budget_test.cxx: added the budget of the missing argument
+//   shown with the pre-rendered usage.
+// * allocation_budget_test.cxx: the carry buffer of the grep strategy is
+//   reserved on the heap.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "action_registry.hxx"
+#include "argv_parser.hxx"
+#include "cli_actions.hxx"
+#include "cli_template_app.hxx"
+#include "count_strategy.hxx"
+#include "grep_strategy.hxx"
+#include "hello_world_strategy.hxx"
+#include "help_text.hxx"  // Generated at build time
+#include "output_sinks.hxx"
+#include "tree_walker.hxx"
+#include "walk_strategy.hxx"
+
+// Test headers
+#include "temporary_files.hxx"
+
+// Standard library headers
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <string_view>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Allocation Counting Section
+// ============================================================================
+
+namespace {
+
+    std::atomic<std::size_t> g_Allocations{0};
+
+};
+
+// Every allocation of the test executable goes through here. The array and
+// the nothrow forms call these by default.
+void* operator new(std::size_t size)
+{
+    g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(0 == size ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Heap allocations done since the counter was created
+class AllocationCounter {
+public:
+  AllocationCounter()
+    : m_Start{g_Allocations.load(std::memory_order_relaxed)}
+  { }
+
+  std::size_t count() const {
+    return g_Allocations.load(std::memory_order_relaxed) - m_Start;
+  }
+
+private:
+  std::size_t m_Start;
+};
+
+// Sink counting the bytes written to it, without storing them
+class CountingSink : public OutputSinks::OutputSink {
+public:
+  void write(std::string_view data) override {
+    m_Size += data.size();
+  }
+
+  bool flush() override {
+    return true;
+  }
+
+  std::size_t size() const {
+    return m_Size;
+  }
+
+private:
+  std::size_t m_Size{0};
+};
+
+// Executes the strategy as the program does and expects it to produce some
+// output within the allocation budget
+template <typename Strategy>
+static void expectExecutionBudget(
+  Strategy const& strategy,
+  std::size_t budget
+) {
+  CountingSink out;
+  CountingSink err;
+
+  AllocationCounter counter;
+  CliActions::executeStatic(kAppName, strategy, out, err);
+
+  EXPECT_LE(counter.count(), budget);
+  EXPECT_GT(out.size() + err.size(), 0u);
+}
+
+// Heap allocations of executing the strategy with an arena that may not
+// fall back to the heap, expecting some output
+template <typename Strategy>
+static std::size_t arenaExecutionAllocations(Strategy const& strategy)
+{
+  std::array<std::byte, 64 * 1024> storage;
+  std::pmr::monotonic_buffer_resource arena{
+    storage.data(),
+    storage.size(),
+    std::pmr::null_memory_resource()
+  };
+  CountingSink out;
+  CountingSink err;
+
+  AllocationCounter counter;
+  CliActions::executeStatic(kAppName, strategy, out, err, arena);
+  std::size_t const count = counter.count();
+
+  EXPECT_GT(out.size(), 0u);
+  return count;
+}
+
+// Text of `lines' lines of 100 bytes, each holding the word `match'
+static std::string matchingLines(std::size_t lines)
+{
+  std::string line = "match" + std::string(94, 'x') + "\n";
+  std::string text;
+  for (std::size_t i = 0; i < lines; ++i) {
+    text += line;
+  }
+  return text;
+}
+
+// Directory holding `directories' subdirectories of `files' files each.
+// Removed by the destructor.
+class TemporaryTree {
+public:
+  TemporaryTree(int directories, int files) : m_Root{uniqueTestPath()} {
+    for (int i = 0; i < directories; ++i) {
+      auto const directory = m_Root / ("dir" + std::to_string(i));
+      std::filesystem::create_directories(directory);
+      for (int j = 0; j < files; ++j) {
+        std::ofstream{directory / ("file" + std::to_string(j))} << "x";
+      }
+    }
+  }
+
+  ~TemporaryTree() {
+    std::error_code ignored;
+    std::filesystem::remove_all(m_Root, ignored);
+  }
+
+  std::string path() const {
+    return m_Root.string();
+  }
+
+private:
+  std::filesystem::path m_Root;
+};
+
+// Visitor doing nothing, the cost of a bare walk
+class NullVisitor : public TreeWalker::FileVisitor {
+public:
+  std::unique_ptr<TreeWalker::FileVisitor> fork() const override {
+    return std::make_unique<NullVisitor>();
+  }
+
+  void visit(std::filesystem::directory_entry const&) override { }
+
+  void merge(TreeWalker::FileVisitor&) override { }
+};
+
+// Arguments the unsupported options strategy reports
+char const* const kUnsupportedArgs[] = {"--foo", "bar"};
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// AllocationBudgetTest
+// ----------------------------------------------------------------------------
+//
+// Description: Parsing the command line, building an action and executing it
+//              stay within the allocation budget of each action. Most of the
+//              budgets are zero: the strategies view their data and write it
+//              into the sinks. The help, the usage and the missing argument
+//              texts are pre-rendered, and shown without allocating. Only
+//              when the program runs under another name than its own (the
+//              exec name is a part of the texts) clipp renders them, which
+//              allocates and is left out of the budget.
+//
+//              The input and the walk strategies take their scratch memory
+//              from the arena, or reserve it once on the heap (the carry
+//              buffer of the record reader), so their heap allocations do
+//              not depend on the size of the input or on the number of
+//              files listed.
+//
+// ----------------------------------------------------------------------------
+
+// Case: CounterSeesAllocations -----------------------------------------------
+TEST(AllocationBudgetTest, CounterSeesAllocations) {
+  AllocationCounter counter;
+  delete new int{0};
+  EXPECT_EQ(counter.count(), 1u);
+}
+
+// Case: Parse ----------------------------------------------------------------
+TEST(AllocationBudgetTest, Parse) {
+  char const* argv[] = {"app", "--serve", "--socket", "/tmp/s", "-h", "bar"};
+  CliOptionViews options{kDefaultOptionViews};
+
+  AllocationCounter counter;
+  kOptionTable.parse(6, argv, options);
+
+  EXPECT_EQ(counter.count(), 0u);
+  EXPECT_EQ(options.m_Inputs.size(), 1u);
+}
+
+// Case: BuildStrategies ------------------------------------------------------
+TEST(AllocationBudgetTest, BuildStrategies) {
+  appOptions();  // Built once on first use
+
+  AllocationCounter counter;
+  auto help = makeShowHelpStrategy();
+  auto usage = makeShowUsageStrategy();
+  auto version = makeShowVersionStrategy();
+  CliActions::MissingArgumentStrategyClipp missing{
+    "missing argument",
+    appOptions()
+  };
+  // Copies are as cheap, the program action holds one
+  [[maybe_unused]] auto helpCopy = help;
+  [[maybe_unused]] auto usageCopy = usage;
+  [[maybe_unused]] auto versionCopy = version;
+  [[maybe_unused]] auto missingCopy = missing;
+
+  EXPECT_EQ(counter.count(), 0u);
+}
+
+// Case: ExecuteHelloWorld ----------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteHelloWorld) {
+  expectExecutionBudget(HelloWorldStrategy{}, 0);
+}
+
+// Case: ExecuteStaticText ----------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteStaticText) {
+  expectExecutionBudget(CliActions::ShowStaticTextStrategy{kAppDoc}, 0);
+}
+
+// Case: ExecuteShortHelp -----------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteShortHelp) {
+  expectExecutionBudget(CliActions::ShowShortHelpStrategy{}, 0);
+}
+
+// Case: ExecuteVersion -------------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteVersion) {
+  expectExecutionBudget(makeShowVersionStrategy(), 0);
+}
+
+// Case: ExecuteMissingArgument -----------------------------------------------
+TEST(AllocationBudgetTest, ExecuteMissingArgument) {
+  expectExecutionBudget(
+    CliActions::MissingArgumentStrategy{
+      "option '--grep' requires an argument",
+      PrerenderedText::kMissingArgumentUsage
+    },
+    0
+  );
+}
+
+// Case: ExecuteUnsupported ---------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteUnsupported) {
+  expectExecutionBudget(
+    CliActions::UnsupportedOptionsStrategyClipp{
+      ArgvParser::ArgSpan{kUnsupportedArgs, 2}
+    },
+    0
+  );
+}
+
+// Case: ArenaAction ----------------------------------------------------------
+TEST(AllocationBudgetTest, ArenaAction) {
+  // The arena may not fall back to the heap
+  std::array<std::byte, 1024> storage;
+  std::pmr::monotonic_buffer_resource arena{
+    storage.data(),
+    storage.size(),
+    std::pmr::null_memory_resource()
+  };
+  CountingSink out;
+  CountingSink err;
+
+  // The callable viewing the strategy is stored inline
+  auto const strategy = makeShowVersionStrategy();
+  AllocationCounter counter;
+  CliActions::CliAction action{
+    kAppName,
+    [&strategy](CliActions::CliAction const& action) {
+      return strategy(action);
+    },
+    out,
+    err,
+    arena
+  };
+  int status = action.execute();
+
+  EXPECT_EQ(counter.count(), 0u);
+  EXPECT_EQ(status, EXIT_SUCCESS);
+  EXPECT_GT(out.size(), 0u);
+  EXPECT_EQ(&action.arena(), &arena);
+}
+
+// Case: ExecuteGrep ----------------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteGrep) {
+  // Lines span the chunks, so the record reader carries them over. Both
+  // inputs are several chunks long, the read backend starts its reader
+  // thread for either.
+  TemporaryFile small{matchingLines(100)};
+  TemporaryFile large{matchingLines(2000)};
+  std::string const smallPath = small.path();
+  std::string const largePath = large.path();
+  char const* smallInputs[] = {smallPath.c_str()};
+  char const* largeInputs[] = {largePath.c_str()};
+
+  for (auto backend : {"mmap", "read"}) {
+    SCOPED_TRACE(backend);
+    CliActions::InputOptions options;
+    options.backend = backend;
+    options.chunk_size = 4096;
+
+    auto const smallCount = arenaExecutionAllocations(
+      GrepStrategy{"match", ArgvParser::ArgSpan{smallInputs, 1}, options}
+    );
+    auto const largeCount = arenaExecutionAllocations(
+      GrepStrategy{"match", ArgvParser::ArgSpan{largeInputs, 1}, options}
+    );
+    EXPECT_EQ(largeCount, smallCount);
+    EXPECT_LE(largeCount, 3u);
+  }
+}
+
+// Case: ExecuteCount ---------------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteCount) {
+  TemporaryFile small{matchingLines(100)};
+  TemporaryFile large{matchingLines(2000)};
+  std::string const smallPath = small.path();
+  std::string const largePath = large.path();
+  char const* smallInputs[] = {smallPath.c_str()};
+  char const* largeInputs[] = {largePath.c_str()};
+
+  for (auto backend : {"mmap", "read"}) {
+    SCOPED_TRACE(backend);
+    CliActions::InputOptions options;
+    options.backend = backend;
+    options.chunk_size = 4096;
+
+    auto const smallCount = arenaExecutionAllocations(
+      CountStrategy{ArgvParser::ArgSpan{smallInputs, 1}, options}
+    );
+    auto const largeCount = arenaExecutionAllocations(
+      CountStrategy{ArgvParser::ArgSpan{largeInputs, 1}, options}
+    );
+    EXPECT_EQ(largeCount, smallCount);
+    EXPECT_LE(largeCount, 3u);
+  }
+}
+
+// Case: ExecuteWalk ----------------------------------------------------------
+TEST(AllocationBudgetTest, ExecuteWalk) {
+  // Listing lines enough to fill the listing buffer many times
+  TemporaryTree tree{4, 200};
+  std::string const root = tree.path();
+  char const* roots[] = {root.c_str()};
+
+  // A single worker walks the same way every time. The listing adds no
+  // allocation of its own to those of the walk.
+  AllocationCounter bareCounter;
+  NullVisitor visitor;
+  TreeWalker::walk(ArgvParser::ArgSpan{roots, 1}, visitor, 1);
+  std::size_t const bareCount = bareCounter.count();
+
+  auto const listingCount = arenaExecutionAllocations(
+    WalkStrategy{ArgvParser::ArgSpan{roots, 1}, "1"}
+  );
+  EXPECT_LE(listingCount, bareCount);
+}
+
+
+// End of `allocation_budget_test.cxx'
@@ -0,0 +1,301 @@
+// ============================================================================
+//
+// File:        argv_parser_test.cxx
+// Description: Unit tests for the allocation-free argument vector parser, and
+//              differential tests of `kOptionTable' against clipp
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * argv_parser_test.cxx: created.
+// * argv_parser_test.cxx: added the positional argument cases.
+// * argv_parser_test.cxx: added the empty value cases.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "argv_parser.hxx"
+#include "cli_template_app.hxx"
+
+// Standard library headers
+#include <string>
+#include <string_view>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Argument vector with the program name in front, as `main()' receives it
+class ArgumentVector {
+public:
+  explicit ArgumentVector(std::vector<std::string> args)
+    : m_Args(std::move(args))
+  {
+    m_Args.insert(m_Args.begin(), std::string {kAppName});
+    for (auto& arg : m_Args) {
+      m_Argv.push_back(arg.data());
+    }
+  }
+
+  int argc() const {
+    return static_cast<int>(m_Argv.size());
+  }
+
+  char** argv() {
+    return m_Argv.data();
+  }
+
+private:
+  std::vector<std::string> m_Args;
+  std::vector<char*> m_Argv;
+};
+
+// Parses the arguments with clipp and with `kOptionTable', and expects the
+// same option values from both
+static void expectSameAsClipp(std::vector<std::string> const& args)
+{
+  SCOPED_TRACE(testing::PrintToString(args));
+
+  ArgumentVector clippArgv{args};
+  userOptionValues = kDefaultOptionValues;
+  clipp::parse(clippArgv.argc(), clippArgv.argv(), appOptions());
+
+  ArgumentVector tableArgv{args};
+  CliOptionViews views{kDefaultOptionViews};
+  kOptionTable.parse(tableArgv.argc(), tableArgv.argv(), views);
+
+  EXPECT_EQ(views.m_ShowHelp, userOptionValues.m_ShowHelp);
+  EXPECT_EQ(views.m_PrintUsage, userOptionValues.m_PrintUsage);
+  EXPECT_EQ(views.m_ShowVersion, userOptionValues.m_ShowVersion);
+  EXPECT_EQ(views.m_Serve, userOptionValues.m_Serve);
+  EXPECT_EQ(views.m_ServeNullDelimited, userOptionValues.m_ServeNullDelimited);
+  EXPECT_EQ(std::string {views.m_ServeSocket}, userOptionValues.m_ServeSocket);
+  EXPECT_EQ(std::string {views.m_GrepPattern}, userOptionValues.m_GrepPattern);
+  EXPECT_EQ(views.m_Count, userOptionValues.m_Count);
+  EXPECT_EQ(views.m_Walk, userOptionValues.m_Walk);
+  EXPECT_EQ(std::string {views.m_Jobs}, userOptionValues.m_Jobs);
+  EXPECT_EQ(views.m_Sort, userOptionValues.m_Sort);
+  EXPECT_EQ(
+    std::string {views.m_InputBackend},
+    userOptionValues.m_InputBackend
+  );
+
+  std::vector<std::string> inputs(
+    views.m_Inputs.begin(),
+    views.m_Inputs.end()
+  );
+  EXPECT_EQ(inputs, userOptionValues.m_Inputs);
+
+  std::vector<std::string> unsupported(
+    views.m_Unsupported.begin(),
+    views.m_Unsupported.end()
+  );
+  EXPECT_EQ(unsupported, userOptionValues.m_Unsupported);
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// ArgvParserTest
+// ----------------------------------------------------------------------------
+//
+// Description: The option table finds exactly its own option names, and the
+//              parser fills the values without copying any argument.
+//
+// ----------------------------------------------------------------------------
+
+// Case: FindsEveryOption -----------------------------------------------------
+TEST(ArgvParserTest, FindsEveryOption) {
+  for (auto const& option : kOptionTable.options()) {
+    EXPECT_EQ(kOptionTable.find(option.name), &option) << option.name;
+  }
+}
+
+// Case: RejectsOtherNames ----------------------------------------------------
+TEST(ArgvParserTest, RejectsOtherNames) {
+  for (std::string_view name : {
+    "", "-", "--", "-x", "--hel", "--helpx", "help", "-hV", "--socket=x"
+  }) {
+    EXPECT_EQ(kOptionTable.find(name), nullptr) << name;
+  }
+}
+
+// Case: ValuesViewArguments --------------------------------------------------
+TEST(ArgvParserTest, ValuesViewArguments) {
+  ArgumentVector argv{{"bar", "--socket", "/tmp/s", "-V", "--foo"}};
+  CliOptionViews views{kDefaultOptionViews};
+  auto result = kOptionTable.parse(argv.argc(), argv.argv(), views);
+
+  EXPECT_TRUE(result);
+  EXPECT_TRUE(views.m_ShowVersion);
+  EXPECT_EQ(views.m_ServeSocket, "/tmp/s");
+  ASSERT_EQ(views.m_Inputs.size(), 1u);
+  EXPECT_EQ(views.m_Inputs[0], "bar");
+  ASSERT_EQ(views.m_Unsupported.size(), 1u);
+  EXPECT_EQ(views.m_Unsupported[0], "--foo");
+  // The positional and then the unsupported arguments are moved right after
+  // the program name
+  EXPECT_EQ(views.m_Inputs.begin(), argv.argv() + 1);
+  EXPECT_EQ(views.m_Unsupported.begin(), views.m_Inputs.end());
+}
+
+// Case: PositionalsKeepOrder -------------------------------------------------
+TEST(ArgvParserTest, PositionalsKeepOrder) {
+  ArgumentVector argv{{"-x", "a", "--grep", "b", "-y", "c", "d", "-z"}};
+  CliOptionViews views{kDefaultOptionViews};
+  kOptionTable.parse(argv.argc(), argv.argv(), views);
+
+  EXPECT_EQ(views.m_GrepPattern, "b");
+  ASSERT_EQ(views.m_Inputs.size(), 3u);
+  EXPECT_EQ(views.m_Inputs[0], "a");
+  EXPECT_EQ(views.m_Inputs[1], "c");
+  EXPECT_EQ(views.m_Inputs[2], "d");
+  ASSERT_EQ(views.m_Unsupported.size(), 3u);
+  EXPECT_EQ(views.m_Unsupported[0], "-x");
+  EXPECT_EQ(views.m_Unsupported[1], "-y");
+  EXPECT_EQ(views.m_Unsupported[2], "-z");
+}
+
+// Case: MissingValue ---------------------------------------------------------
+TEST(ArgvParserTest, MissingValue) {
+  ArgumentVector argv{{"--serve", "--socket"}};
+  CliOptionViews views{kDefaultOptionViews};
+  auto result = kOptionTable.parse(argv.argc(), argv.argv(), views);
+
+  EXPECT_FALSE(result);
+  EXPECT_EQ(result.missing_value, "--socket");
+  EXPECT_TRUE(views.m_Serve);
+  EXPECT_TRUE(views.m_ServeSocket.empty());
+  EXPECT_TRUE(views.m_Unsupported.empty());
+}
+
+// Case: EmptyValue -----------------------------------------------------------
+TEST(ArgvParserTest, EmptyValue) {
+  ArgumentVector argv{{"--grep", "", "--count"}};
+  CliOptionViews views{kDefaultOptionViews};
+  auto result = kOptionTable.parse(argv.argc(), argv.argv(), views);
+
+  EXPECT_FALSE(result);
+  EXPECT_EQ(result.missing_value, "--grep");
+  EXPECT_TRUE(views.m_GrepPattern.empty());
+  EXPECT_TRUE(views.m_Count);
+}
+
+// Case: ConstantStrings ------------------------------------------------------
+TEST(ArgvParserTest, ConstantStrings) {
+  char const* argv[] = {"app", "-h", "bar"};
+  CliOptionViews views{kDefaultOptionViews};
+  kOptionTable.parse(3, argv, views);
+
+  EXPECT_TRUE(views.m_ShowHelp);
+  ASSERT_EQ(views.m_Inputs.size(), 1u);
+  EXPECT_EQ(views.m_Inputs[0], "bar");
+  EXPECT_TRUE(views.m_Unsupported.empty());
+}
+
+// ----------------------------------------------------------------------------
+// ArgvParserDifferentialTest
+// ----------------------------------------------------------------------------
+//
+// Description: `kOptionTable' must parse every argument vector into the same
+//              option values as clipp parses it with `appOptions()'.
+//
+// ----------------------------------------------------------------------------
+
+// Case: SingleOptions --------------------------------------------------------
+TEST(ArgvParserDifferentialTest, SingleOptions) {
+  expectSameAsClipp({});
+  for (auto const& option : kOptionTable.options()) {
+    if (ArgvParser::OptionKind::Flag == option.kind) {
+      expectSameAsClipp({std::string {option.name}});
+    } else {
+      expectSameAsClipp({std::string {option.name}, "value"});
+    }
+  }
+}
+
+// Case: Combinations ---------------------------------------------------------
+TEST(ArgvParserDifferentialTest, Combinations) {
+  expectSameAsClipp({"-h", "--usage", "-V"});
+  expectSameAsClipp({"--serve", "-0", "--socket", "/tmp/socket"});
+  expectSameAsClipp({"--null", "--serve"});
+  expectSameAsClipp({"--version", "--help"});
+}
+
+// Case: UnsupportedArguments -------------------------------------------------
+TEST(ArgvParserDifferentialTest, UnsupportedArguments) {
+  expectSameAsClipp({"--foo"});
+  expectSameAsClipp({"bar"});
+  expectSameAsClipp({"-h", "--foo", "bar", "-V"});
+  expectSameAsClipp({"--help=1"});
+  expectSameAsClipp({"-hV"});
+  expectSameAsClipp({"--socket=/tmp/socket"});
+  expectSameAsClipp({"-x", "-y", "-z", "--serve"});
+}
+
+// Case: InputFiles -----------------------------------------------------------
+TEST(ArgvParserDifferentialTest, InputFiles) {
+  expectSameAsClipp({"a.log", "b.log"});
+  expectSameAsClipp({"--grep", "error", "a.log", "-", "b.log"});
+  expectSameAsClipp({"a.log", "--input-backend", "mmap", "--foo", "b.log"});
+  expectSameAsClipp({"--grep", "-v", "a.log"});
+  expectSameAsClipp({"--count", "a.log", "--input-backend", "read", "b.log"});
+  expectSameAsClipp({"--walk", "src", "--jobs", "4", "--sort", "include"});
+  expectSameAsClipp({"--walk", "--jobs=2", "src"});
+}
+
+// Case: ValueOptions ---------------------------------------------------------
+TEST(ArgvParserDifferentialTest, ValueOptions) {
+  // The value is taken whatever it looks like
+  expectSameAsClipp({"--socket", "--help"});
+  expectSameAsClipp({"--socket", "bar", "baz"});
+  expectSameAsClipp({"--socket"});
+
+  // but an empty argument is not a value
+  expectSameAsClipp({"--grep", ""});
+  expectSameAsClipp({"--grep", "", "a.log"});
+  expectSameAsClipp({"--walk", "--jobs", "", "src"});
+  expectSameAsClipp({"--count", "--input-backend", "", "--", ""});
+  expectSameAsClipp({"", "--socket", ""});
+}
+
+
+// End of `argv_parser_test.cxx'
@@ -0,0 +1,357 @@
+// ============================================================================
+//
+// File:        batch_server_test.cxx
+// Description: Unit tests for the batch mode request framing and replies
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * batch_server_test.cxx: created.
+// * batch_server_test.cxx: added a case for a read error.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "batch_server.hxx"
+#include "output_sinks.hxx"
+
+// Standard library headers
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// System headers
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Pipe closed by the destructor. The tests write less than the capacity of a
+// pipe, so the writing end is filled and closed before the reading starts.
+class Pipe {
+public:
+    Pipe() {
+#if defined(_WIN32)
+        m_Good = 0 == _pipe(m_Fds, 64 * 1024, _O_BINARY);
+#else
+        m_Good = 0 == ::pipe(m_Fds);
+#endif
+    }
+
+    ~Pipe() {
+        closeWriteEnd();
+        closeFd(m_Fds[0]);
+    }
+
+    bool good() const {
+        return m_Good;
+    }
+
+    int readFd() const {
+        return m_Fds[0];
+    }
+
+    int writeFd() const {
+        return m_Fds[1];
+    }
+
+    void write(std::string_view data) {
+#if defined(_WIN32)
+        _write(m_Fds[1], data.data(), static_cast<unsigned>(data.size()));
+#else
+        ssize_t written = ::write(m_Fds[1], data.data(), data.size());
+        (void)written;
+#endif
+    }
+
+    void closeWriteEnd() {
+        closeFd(m_Fds[1]);
+    }
+
+    // Everything written until the writing end was closed
+    std::string readAll() {
+        std::string data;
+        char buffer[4096];
+        for (;;) {
+#if defined(_WIN32)
+            int n = _read(m_Fds[0], buffer, sizeof(buffer));
+#else
+            ssize_t n = ::read(m_Fds[0], buffer, sizeof(buffer));
+#endif
+            if (n <= 0) {
+                return data;
+            }
+            data.append(buffer, static_cast<std::size_t>(n));
+        }
+    }
+
+private:
+    static void closeFd(int& fd) {
+        if (fd >= 0) {
+#if defined(_WIN32)
+            _close(fd);
+#else
+            ::close(fd);
+#endif
+            fd = -1;
+        }
+    }
+
+    int m_Fds[2]{-1, -1};
+    bool m_Good{false};
+};
+
+// Requests read from the stream with the given framing
+static std::vector<BatchServer::ArgList> readRequests(
+    std::string_view stream,
+    BatchServer::RecordFormat format,
+    std::size_t buffer_size = BatchServer::DEFAULT_READ_BUFFER_SIZE
+) {
+    Pipe pipe;
+    EXPECT_TRUE(pipe.good());
+    pipe.write(stream);
+    pipe.closeWriteEnd();
+
+    BatchServer::RequestReader reader{pipe.readFd(), format, buffer_size};
+    std::vector<BatchServer::ArgList> requests;
+    BatchServer::ArgList args;
+    while (reader.next(args)) {
+        requests.push_back(args);
+    }
+    return requests;
+}
+
+using Requests = std::vector<BatchServer::ArgList>;
+
+constexpr auto kLines = BatchServer::RecordFormat::Lines;
+constexpr auto kNullDelimited = BatchServer::RecordFormat::NullDelimited;
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// RequestReaderTest
+// ----------------------------------------------------------------------------
+//
+// Description: The byte stream is split into the argument vectors exactly,
+//              however the requests are framed and split into reads.
+//
+// ----------------------------------------------------------------------------
+
+// Case: LineFraming ----------------------------------------------------------
+TEST(RequestReaderTest, LineFraming) {
+  EXPECT_EQ(
+    readRequests("--grep x a.log\n\t--count  b.log \n-h\n", kLines),
+    (Requests{{"--grep", "x", "a.log"}, {"--count", "b.log"}, {"-h"}})
+  );
+}
+
+// Case: NullFraming ----------------------------------------------------------
+TEST(RequestReaderTest, NullFraming) {
+  using namespace std::string_literals;
+  EXPECT_EQ(
+    readRequests("--grep\0a b\0c.log\0\0-h\0\0"s, kNullDelimited),
+    (Requests{{"--grep", "a b", "c.log"}, {"-h"}})
+  );
+}
+
+// Case: RequestSpansReads ----------------------------------------------------
+TEST(RequestReaderTest, RequestSpansReads) {
+  std::string const long_arg(10000, 'x');
+  std::string const stream = "--grep " + long_arg + " a.log\n--usage\n";
+
+  // The buffer starts out smaller than a single argument and has to grow
+  for (std::size_t buffer_size : {1, 3, 16, 64 * 1024}) {
+    SCOPED_TRACE("buffer " + std::to_string(buffer_size));
+    EXPECT_EQ(
+      readRequests(stream, kLines, buffer_size),
+      (Requests{{"--grep", long_arg, "a.log"}, {"--usage"}})
+    );
+  }
+}
+
+// Case: StripsCarriageReturns ------------------------------------------------
+TEST(RequestReaderTest, StripsCarriageReturns) {
+  EXPECT_EQ(
+    readRequests("--count a.log\r\n-V\r\n", kLines),
+    (Requests{{"--count", "a.log"}, {"-V"}})
+  );
+}
+
+// Case: UnterminatedLastRequest ----------------------------------------------
+TEST(RequestReaderTest, UnterminatedLastRequest) {
+  using namespace std::string_literals;
+  EXPECT_EQ(
+    readRequests("-h\n--count a.log", kLines),
+    (Requests{{"-h"}, {"--count", "a.log"}})
+  );
+  EXPECT_EQ(
+    readRequests("-h\0\0--count\0a.log"s, kNullDelimited),
+    (Requests{{"-h"}, {"--count", "a.log"}})
+  );
+  EXPECT_EQ(
+    readRequests("-h\0\0--count\0a.log\0"s, kNullDelimited),
+    (Requests{{"-h"}, {"--count", "a.log"}})
+  );
+}
+
+// Case: SkipsEmptyRequests ---------------------------------------------------
+TEST(RequestReaderTest, SkipsEmptyRequests) {
+  using namespace std::string_literals;
+  EXPECT_EQ(
+    readRequests("\n \t\n\r\n-h\n\n", kLines),
+    (Requests{{"-h"}})
+  );
+  EXPECT_EQ(readRequests("\n\n", kLines), Requests{});
+  EXPECT_EQ(
+    readRequests("\0\0-h\0\0\0"s, kNullDelimited),
+    (Requests{{"-h"}})
+  );
+}
+
+// ----------------------------------------------------------------------------
+// ServeStreamTest
+// ----------------------------------------------------------------------------
+//
+// Description: Every request is answered with a frame of its status and the
+//              sizes of its outputs, followed by the outputs themselves.
+//
+// ----------------------------------------------------------------------------
+
+// Case: ReadError ------------------------------------------------------------
+#if !defined(_WIN32)
+TEST(ServeStreamTest, ReadError) {
+  // Reading a directory fails with EISDIR
+  int const directory = ::open(".", O_RDONLY);
+  ASSERT_GE(directory, 0);
+  Pipe replies;
+  ASSERT_TRUE(replies.good());
+
+  BatchServer::RequestReader reader{directory, kLines};
+  BatchServer::ArgList args;
+  EXPECT_FALSE(reader.next(args));
+  EXPECT_EQ(reader.error(), EISDIR);
+
+  bool called = false;
+  auto handler = [&called](
+    BatchServer::ArgList const&,
+    OutputSinks::OutputSink&,
+    OutputSinks::OutputSink&
+  ) {
+    called = true;
+    return EXIT_SUCCESS;
+  };
+  OutputSinks::MemorySink err;
+  EXPECT_EQ(
+    BatchServer::serveStream(
+      directory,
+      replies.writeFd(),
+      kLines,
+      handler,
+      err
+    ),
+    EXIT_FAILURE
+  );
+  ::close(directory);
+  replies.closeWriteEnd();
+
+  EXPECT_FALSE(called);
+  EXPECT_EQ(replies.readAll(), "");
+  EXPECT_EQ(
+    err.view(),
+    "ERROR: cannot read the requests: " + std::string{std::strerror(EISDIR)}
+      + "\n"
+  );
+}
+#endif
+
+// Case: ReplyFrames ----------------------------------------------------------
+TEST(ServeStreamTest, ReplyFrames) {
+  Pipe requests;
+  Pipe replies;
+  ASSERT_TRUE(requests.good() && replies.good());
+  requests.write("one\ntwo three\n\nfail\n");
+  requests.closeWriteEnd();
+
+  auto handler = [](
+    BatchServer::ArgList const& args,
+    OutputSinks::OutputSink& out,
+    OutputSinks::OutputSink& err
+  ) {
+    if (args.front() == "fail") {
+      throw std::runtime_error{"boom"};
+    }
+    out << "out:" << args.front();
+    if (args.size() > 1) {
+      err << "err";
+    }
+    return static_cast<int>(args.size());
+  };
+
+  EXPECT_EQ(
+    BatchServer::serveStream(
+      requests.readFd(),
+      replies.writeFd(),
+      kLines,
+      handler
+    ),
+    EXIT_SUCCESS
+  );
+  replies.closeWriteEnd();
+
+  EXPECT_EQ(
+    replies.readAll(),
+    "1 7 0\nout:one"
+    "2 7 3\nout:twoerr"
+    "1 0 12\nERROR: boom\n"
+  );
+}
+
+
+// End of `batch_server_test.cxx'
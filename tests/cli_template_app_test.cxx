@@ -0,0 +1,253 @@
+// ============================================================================
+//
+// File:        cli_template_app_test.cxx
+// Description: Tests running the `cli_template_app' executable
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * cli_template_app_test.cxx: created.
+// * cli_template_app_test.cxx: the input is read from a file, so a run that
+//   fails before reading it does not break a pipe.
+// * cli_template_app_test.cxx: added a case for other options in batch mode.
+// * cli_template_app_test.cxx: added an empty value case.
+// * cli_template_app_test.cxx: added the walk options without `--walk' case.
+// * cli_template_app_test.cxx: added the input backend without an input
+//   action case.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Test headers
+#include "temporary_files.hxx"
+
+// Standard library headers
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+// System headers
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#endif
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Exit status and the standard output and error (merged) of a run
+struct AppRun {
+  int status;
+  std::string output;
+};
+
+// Runs the application with the arguments, feeding it the input. The input
+// comes from a file rather than a pipe, as the application may exit without
+// reading it.
+static AppRun runApp(std::string_view args, std::string_view input = {})
+{
+  TemporaryFile inputFile{input};
+  auto const outputPath = uniqueTestPath(".out");
+  std::string const command = std::string{"\""} + CLI_TEMPLATE_APP + "\" "
+    + std::string{args} + " < \"" + inputFile.path() + "\" > \""
+    + outputPath.string() + "\" 2>&1";
+
+  AppRun run{-1, {}};
+#if defined(_WIN32)
+  run.status = std::system(command.c_str());
+#else
+  int const status = std::system(command.c_str());
+  run.status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+
+  {
+    std::ifstream file{outputPath, std::ios::binary};
+    run.output.assign(
+      std::istreambuf_iterator<char>{file},
+      std::istreambuf_iterator<char>{}
+    );
+  }
+  std::error_code ignored;
+  std::filesystem::remove(outputPath, ignored);
+
+  return run;
+}
+
+static bool contains(std::string_view text, std::string_view part)
+{
+  return text.find(part) != std::string_view::npos;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// CliTemplateAppTest
+// ----------------------------------------------------------------------------
+//
+// Description: The application reports malformed command lines instead of
+//              running an action, on the command line and in batch mode.
+//
+// ----------------------------------------------------------------------------
+
+// Case: MissingValue ---------------------------------------------------------
+TEST(CliTemplateAppTest, MissingValue) {
+  for (std::string_view option : {"--grep", "--jobs", "--input-backend"}) {
+    SCOPED_TRACE(option);
+    auto run = runApp("--walk " + std::string{option});
+    EXPECT_EQ(run.status, EXIT_FAILURE);
+    EXPECT_TRUE(contains(
+      run.output,
+      ": ERROR: option '" + std::string{option} + "' requires an argument"
+    )) << run.output;
+    EXPECT_FALSE(contains(run.output, " total\n")) << run.output;
+  }
+
+  auto run = runApp("--grep");
+  EXPECT_EQ(run.status, EXIT_FAILURE);
+  EXPECT_FALSE(contains(run.output, "Hello")) << run.output;
+
+  // An empty value is no value
+  run = runApp("--grep \"\"", "error\n");
+  EXPECT_EQ(run.status, EXIT_FAILURE);
+  EXPECT_TRUE(contains(
+    run.output,
+    ": ERROR: option '--grep' requires an argument"
+  )) << run.output;
+  EXPECT_FALSE(contains(run.output, "error\n")) << run.output;
+}
+
+// Case: WalkOptionsWithoutWalk ----------------------------------------------
+TEST(CliTemplateAppTest, WalkOptionsWithoutWalk) {
+  struct {
+    std::string_view args;
+    std::string_view unsupported;
+  } const cases[] = {
+    {"--sort", "--sort \n"},
+    {"--jobs 2", "--jobs \n"},
+    {"--sort --jobs 2", "--jobs --sort \n"},
+    {"--count --sort", "--sort \n"},
+  };
+  for (auto const& c : cases) {
+    SCOPED_TRACE(c.args);
+    auto run = runApp(c.args);
+    EXPECT_EQ(run.status, EXIT_FAILURE);
+    EXPECT_TRUE(contains(
+      run.output,
+      ": Unsupported options: " + std::string{c.unsupported}
+    )) << run.output;
+    EXPECT_FALSE(contains(run.output, "Hello")) << run.output;
+  }
+}
+
+// Case: InputBackendWithoutInputAction --------------------------------------
+TEST(CliTemplateAppTest, InputBackendWithoutInputAction) {
+  for (std::string_view args : {
+    "--input-backend read",
+    "--walk --input-backend mmap",
+  }) {
+    SCOPED_TRACE(args);
+    auto run = runApp(args);
+    EXPECT_EQ(run.status, EXIT_FAILURE);
+    EXPECT_TRUE(contains(
+      run.output,
+      ": Unsupported options: --input-backend \n"
+    )) << run.output;
+    EXPECT_FALSE(contains(run.output, "Hello")) << run.output;
+    EXPECT_FALSE(contains(run.output, " total\n")) << run.output;
+  }
+
+  auto run = runApp("--count --input-backend read", "a\nb\n");
+  EXPECT_EQ(run.status, EXIT_SUCCESS) << run.output;
+}
+
+// Case: MissingValueInRequests -----------------------------------------------
+TEST(CliTemplateAppTest, MissingValueInRequests) {
+  auto run = runApp("--serve", "--grep\n--count --input-backend\n");
+  EXPECT_EQ(run.status, EXIT_SUCCESS);
+  EXPECT_EQ(run.output.rfind("1 ", 0), 0u) << run.output;
+  EXPECT_TRUE(contains(
+    run.output,
+    ": ERROR: option '--grep' requires an argument\n"
+  )) << run.output;
+  EXPECT_TRUE(contains(
+    run.output,
+    ": ERROR: option '--input-backend' requires an argument\n"
+  )) << run.output;
+  EXPECT_FALSE(contains(run.output, "Hello")) << run.output;
+}
+
+// Case: OtherOptionsInBatchMode ----------------------------------------------
+TEST(CliTemplateAppTest, OtherOptionsInBatchMode) {
+  for (std::string_view args : {
+    "--serve --help",
+    "--serve --usage",
+    "--serve -V",
+    "--serve --grep x",
+    "--serve --count",
+    "--serve --walk --jobs 2 --sort",
+    "--serve --input-backend read",
+    "--serve input.txt",
+    "--null --socket /nonexistent/socket --count"
+  }) {
+    SCOPED_TRACE(args);
+    // Must not start serving the standard input
+    auto run = runApp(args, "--version\n");
+    EXPECT_EQ(run.status, EXIT_FAILURE);
+    EXPECT_TRUE(contains(
+      run.output,
+      ": ERROR: other options are not allowed in batch mode\n"
+    )) << run.output;
+    EXPECT_FALSE(contains(run.output, "Copyright")) << run.output;
+  }
+}
+
+// Case: MissingSocketPath ----------------------------------------------------
+TEST(CliTemplateAppTest, MissingSocketPath) {
+  // Must not start serving the standard input
+  auto run = runApp("--serve --socket", "-h\n");
+  EXPECT_EQ(run.status, EXIT_FAILURE);
+  EXPECT_TRUE(contains(
+    run.output,
+    ": ERROR: option '--socket' requires an argument"
+  )) << run.output;
+}
+
+
+// End of `cli_template_app_test.cxx'
@@ -0,0 +1,427 @@
+// ============================================================================
+//
+// File:        input_streams_test.cxx
+// Description: Unit tests for the streaming input and the sample grep
+//              strategy
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * input_streams_test.cxx: created.
+// * input_streams_test.cxx: temporary files come from temporary_files.hxx.
+// * input_streams_test.cxx: added a case for resetting a record reader.
+// * input_streams_test.cxx: added a case for the reserved carry buffer.
+//
+// ============================================================================
+
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "argv_parser.hxx"
+#include "grep_strategy.hxx"
+#include "input_streams.hxx"
+#include "output_sinks.hxx"
+
+// Test headers
+#include "temporary_files.hxx"
+
+// Standard library headers
+#include <cerrno>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// System headers
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Lines of random lengths, a few of them longer than the small chunks
+static std::string randomLines(std::size_t count, unsigned seed)
+{
+  std::mt19937 random{seed};
+  std::uniform_int_distribution<int> length{0, 100};
+  std::string text;
+  for (std::size_t i = 0; i < count; ++i) {
+    std::size_t size = static_cast<std::size_t>(length(random));
+    if (0 == i % 50) {
+      size *= 40;
+    }
+    for (std::size_t j = 0; j < size; ++j) {
+      text += static_cast<char>('a' + (i + j) % 26);
+    }
+    text += '\n';
+  }
+  return text;
+}
+
+// Memory resource counting the allocations it passes on to the default one
+class CountingResource : public std::pmr::memory_resource {
+public:
+  std::size_t allocations() const {
+    return m_Allocations;
+  }
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++m_Allocations;
+    return std::pmr::get_default_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(
+    void* p,
+    std::size_t bytes,
+    std::size_t alignment
+  ) override {
+    std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(
+    std::pmr::memory_resource const& other
+  ) const noexcept override {
+    return this == &other;
+  }
+
+  std::size_t m_Allocations{0};
+};
+
+// Reads the input with the record reader, expecting runs of whole records
+static std::string readRecords(
+  int fd,
+  InputStreams::Backend backend,
+  std::size_t chunk_size
+) {
+  auto source = InputStreams::openChunkSource(fd, backend, chunk_size);
+  InputStreams::RecordReader reader{*source};
+  std::string text;
+  std::string_view records;
+  while (reader.next(records)) {
+    EXPECT_FALSE(records.empty());
+    text.append(records.data(), records.size());
+  }
+  EXPECT_EQ(reader.error(), 0);
+  return text;
+}
+
+static constexpr InputStreams::Backend kBackends[] = {
+  InputStreams::Backend::Auto,
+  InputStreams::Backend::Mmap,
+  InputStreams::Backend::Read,
+  InputStreams::Backend::IoUring
+};
+
+static constexpr std::size_t kChunkSizes[] = {1, 7, 4096, 1024 * 1024};
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// InputStreamsTest
+// ----------------------------------------------------------------------------
+//
+// Description: Every backend reads the input exactly, with any chunk size,
+//              and the record reader hands out whole records only.
+//
+// ----------------------------------------------------------------------------
+
+// Case: BackendNames ---------------------------------------------------------
+TEST(InputStreamsTest, BackendNames) {
+  for (auto backend : kBackends) {
+    InputStreams::Backend parsed = InputStreams::Backend::Auto;
+    EXPECT_TRUE(InputStreams::parseBackend(
+      InputStreams::backendName(backend),
+      parsed
+    ));
+    EXPECT_EQ(parsed, backend);
+  }
+  InputStreams::Backend parsed;
+  EXPECT_FALSE(InputStreams::parseBackend("aio", parsed));
+}
+
+// Case: ReadsFilesExactly ----------------------------------------------------
+TEST(InputStreamsTest, ReadsFilesExactly) {
+  std::string const text = randomLines(500, 1);
+  TemporaryFile file{text};
+
+  for (auto backend : kBackends) {
+    for (auto chunkSize : kChunkSizes) {
+      SCOPED_TRACE(std::string {InputStreams::backendName(backend)}
+        + " chunk " + std::to_string(chunkSize));
+      InputStreams::InputFile input{file.path().c_str()};
+      ASSERT_TRUE(input.good());
+      EXPECT_EQ(readRecords(input.fd(), backend, chunkSize), text);
+    }
+  }
+}
+
+// Case: RunsEndWithDelimiter -------------------------------------------------
+TEST(InputStreamsTest, RunsEndWithDelimiter) {
+  TemporaryFile file{"first\nsecond\nno delimiter at the end"};
+
+  for (auto backend : kBackends) {
+    SCOPED_TRACE(InputStreams::backendName(backend));
+    InputStreams::InputFile input{file.path().c_str()};
+    auto source = InputStreams::openChunkSource(input.fd(), backend, 4);
+    InputStreams::RecordReader reader{*source};
+
+    std::vector<std::string> runs;
+    std::string_view records;
+    while (reader.next(records)) {
+      runs.emplace_back(records);
+    }
+    ASSERT_EQ(runs.size(), 3u);
+    EXPECT_EQ(runs[0], "first\n");
+    EXPECT_EQ(runs[1], "second\n");
+    EXPECT_EQ(runs[2], "no delimiter at the end");
+  }
+}
+
+// Case: ResetToNextInput -----------------------------------------------------
+TEST(InputStreamsTest, ResetToNextInput) {
+  TemporaryFile first{"one\ntwo without an end"};
+  TemporaryFile second{"three\nfour\n"};
+
+  for (auto backend : kBackends) {
+    SCOPED_TRACE(InputStreams::backendName(backend));
+    std::pmr::monotonic_buffer_resource memory;
+    InputStreams::InputFile firstInput{first.path().c_str()};
+    auto firstSource = InputStreams::openChunkSource(
+      firstInput.fd(),
+      backend,
+      4
+    );
+    InputStreams::RecordReader reader{*firstSource, '\n', &memory};
+
+    // What is left of the first input is dropped
+    std::string_view records;
+    ASSERT_TRUE(reader.next(records));
+    EXPECT_EQ(records, "one\n");
+
+    InputStreams::InputFile secondInput{second.path().c_str()};
+    auto secondSource = InputStreams::openChunkSource(
+      secondInput.fd(),
+      backend,
+      4
+    );
+    reader.reset(*secondSource);
+    std::string text;
+    while (reader.next(records)) {
+      text.append(records.data(), records.size());
+    }
+    EXPECT_EQ(text, "three\nfour\n");
+    EXPECT_EQ(reader.error(), 0);
+  }
+}
+
+// Case: ReservedCarry --------------------------------------------------------
+TEST(InputStreamsTest, ReservedCarry) {
+  // Every line spans the chunks, none is longer than the reserved room
+  TemporaryFile file{"one\ntwo three\nfour five six\nseven\n"};
+
+  for (auto backend : kBackends) {
+    SCOPED_TRACE(InputStreams::backendName(backend));
+    CountingResource memory;
+    InputStreams::InputFile input{file.path().c_str()};
+    auto source = InputStreams::openChunkSource(input.fd(), backend, 4);
+    InputStreams::RecordReader reader{*source, '\n', &memory};
+    reader.reserve(16);
+
+    std::string text;
+    std::string_view records;
+    while (reader.next(records)) {
+      text.append(records.data(), records.size());
+    }
+    EXPECT_EQ(text, "one\ntwo three\nfour five six\nseven\n");
+    EXPECT_EQ(memory.allocations(), 1u);
+  }
+}
+
+// Case: EmptyFile ------------------------------------------------------------
+TEST(InputStreamsTest, EmptyFile) {
+  TemporaryFile file{""};
+
+  for (auto backend : kBackends) {
+    SCOPED_TRACE(InputStreams::backendName(backend));
+    InputStreams::InputFile input{file.path().c_str()};
+    EXPECT_EQ(readRecords(input.fd(), backend, 16), "");
+  }
+}
+
+// Case: ChosenBackend --------------------------------------------------------
+TEST(InputStreamsTest, ChosenBackend) {
+  TemporaryFile file{"data\n"};
+  InputStreams::InputFile input{file.path().c_str()};
+
+  auto source = InputStreams::openChunkSource(
+    input.fd(),
+    InputStreams::Backend::Read
+  );
+  EXPECT_EQ(source->backend(), InputStreams::Backend::Read);
+
+  for (auto backend : {
+    InputStreams::Backend::Mmap,
+    InputStreams::Backend::IoUring
+  }) {
+    source = InputStreams::openChunkSource(input.fd(), backend);
+    EXPECT_EQ(
+      source->backend(),
+      InputStreams::backendAvailable(backend)
+        ? backend
+        : InputStreams::Backend::Read
+    );
+  }
+}
+
+// Case: MissingFile ----------------------------------------------------------
+TEST(InputStreamsTest, MissingFile) {
+  InputStreams::InputFile input{"/nonexistent/input_streams_test.txt"};
+  EXPECT_FALSE(input.good());
+  EXPECT_EQ(input.error(), ENOENT);
+}
+
+#if !defined(_WIN32)
+
+// Case: ReadsPipes -----------------------------------------------------------
+TEST(InputStreamsTest, ReadsPipes) {
+  std::string const text = randomLines(2000, 2);
+
+  for (auto backend : kBackends) {
+    SCOPED_TRACE(InputStreams::backendName(backend));
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    std::thread writer{[&text, fd = fds[1]] {
+      // Small writes, so the reads return partial chunks
+      for (std::size_t at = 0; at < text.size(); at += 1000) {
+        std::size_t size = std::min<std::size_t>(1000, text.size() - at);
+        ASSERT_EQ(::write(fd, text.data() + at, size), static_cast<long>(size));
+      }
+      ::close(fd);
+    }};
+
+    EXPECT_EQ(readRecords(fds[0], backend, 64 * 1024), text);
+    writer.join();
+    ::close(fds[0]);
+  }
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// GrepStrategyTest
+// ----------------------------------------------------------------------------
+//
+// Description: The sample strategy prints the matching lines once each,
+//              prefixed with the input name when there are more inputs.
+//
+// ----------------------------------------------------------------------------
+
+// Case: MatchingLines --------------------------------------------------------
+TEST(GrepStrategyTest, MatchingLines) {
+  TemporaryFile file{"one error\ntwo\nerror error three\nfour\nlast error"};
+  std::string path = file.path();
+  char const* inputs[] = {path.c_str()};
+
+  for (auto backend : kBackends) {
+    SCOPED_TRACE(InputStreams::backendName(backend));
+    CliActions::InputOptions options;
+    options.backend = InputStreams::backendName(backend);
+    options.chunk_size = 5;
+
+    OutputSinks::MemorySink out;
+    OutputSinks::MemorySink err;
+    GrepStrategy grep{"error", ArgvParser::ArgSpan{inputs, 1}, options};
+    int status = grep(CliActions::ActionContext{"app", out, err});
+
+    EXPECT_EQ(status, EXIT_SUCCESS);
+    EXPECT_EQ(out.view(), "one error\nerror error three\nlast error\n");
+    EXPECT_EQ(err.view(), "");
+  }
+}
+
+// Case: PrefixesInputNames ---------------------------------------------------
+TEST(GrepStrategyTest, PrefixesInputNames) {
+  TemporaryFile first{"a match\nnothing\n"};
+  TemporaryFile second{"nothing\nanother match\n"};
+  std::string paths[] = {first.path(), second.path()};
+  char const* inputs[] = {paths[0].c_str(), paths[1].c_str()};
+
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+  GrepStrategy grep{"match", ArgvParser::ArgSpan{inputs, 2}};
+  grep(CliActions::ActionContext{"app", out, err});
+
+  EXPECT_EQ(
+    out.view(),
+    paths[0] + ":a match\n" + paths[1] + ":another match\n"
+  );
+}
+
+// Case: ReportsErrors --------------------------------------------------------
+TEST(GrepStrategyTest, ReportsErrors) {
+  char const* inputs[] = {"/nonexistent/input_streams_test.txt"};
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+
+  GrepStrategy grep{"x", ArgvParser::ArgSpan{inputs, 1}};
+  EXPECT_EQ(grep(CliActions::ActionContext{"app", out, err}), EXIT_FAILURE);
+  EXPECT_NE(err.view().find("app: /nonexistent/input_streams_test.txt: "),
+    std::string_view::npos);
+
+  CliActions::InputOptions options;
+  options.backend = "aio";
+  GrepStrategy badBackend{"x", ArgvParser::ArgSpan{inputs, 1}, options};
+  EXPECT_EQ(
+    badBackend(CliActions::ActionContext{"app", out, err}),
+    EXIT_FAILURE
+  );
+  EXPECT_NE(err.view().find("unknown input backend 'aio'"),
+    std::string_view::npos);
+}
+
+
+// End of `input_streams_test.cxx'
@@ -0,0 +1,182 @@
+// ============================================================================
+//
+// File:        output_sinks_test.cxx
+// Description: Unit tests for the output sinks
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * output_sinks_test.cxx: created.
+// * output_sinks_test.cxx: added a case for the caller provided buffer.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "output_sinks.hxx"
+
+// Standard library headers
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Reads the whole file into a string
+static std::string readFile(std::string const& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string {
+        std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>()
+    };
+}
+
+// Writes a mix of small, static and large pieces, returns what was written
+static std::string writeMixed(OutputSinks::OutputSink& sink)
+{
+    static constexpr std::string_view kStatic = "static text\n";
+    std::string large(100000, 'x');
+    std::string expected;
+
+    for (int i = 0; i < 1000; ++i) {
+        sink << "line " << i << '\n';
+        expected += "line " + std::to_string(i) + "\n";
+        if (i % 100 == 0) {
+            sink.writeStatic(kStatic);
+            expected += kStatic;
+        }
+    }
+    sink.write(large);
+    expected += large;
+    sink << "tail\n";
+    expected += "tail\n";
+
+    return expected;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// OutputSinksTest
+// ----------------------------------------------------------------------------
+//
+// Description: Every sink must deliver exactly the bytes written to it, in
+//              order, however they were split into writes.
+//
+// ----------------------------------------------------------------------------
+
+// Case: MemorySinkFormatting -------------------------------------------------
+TEST(OutputSinksTest, MemorySinkFormatting) {
+  OutputSinks::MemorySink sink;
+  sink << "a" << ' ' << 42 << ' ' << -7 << ' ' << 18446744073709551615ULL;
+  EXPECT_EQ(sink.view(), "a 42 -7 18446744073709551615");
+  sink.clear();
+  EXPECT_TRUE(sink.view().empty());
+}
+
+// Case: FdSinkMixedWrites ----------------------------------------------------
+TEST(OutputSinksTest, FdSinkMixedWrites) {
+  std::string path = testing::TempDir() + "output_sinks_test_fd.txt";
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+
+  std::string expected;
+  {
+#if defined(_WIN32)
+    OutputSinks::FdSink sink{_fileno(file), false, 4096};
+#else
+    OutputSinks::FdSink sink{fileno(file), false, 4096};
+#endif
+    expected = writeMixed(sink);
+    EXPECT_TRUE(sink.flush());
+  }
+  std::fclose(file);
+
+  EXPECT_EQ(readFile(path), expected);
+  std::remove(path.c_str());
+}
+
+// Case: FdSinkCallerBuffer ---------------------------------------------------
+TEST(OutputSinksTest, FdSinkCallerBuffer) {
+  std::string path = testing::TempDir() + "output_sinks_test_buffer.txt";
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+
+  static char buffer[4096];
+  std::string expected;
+  {
+#if defined(_WIN32)
+    OutputSinks::FdSink sink{_fileno(file), false, buffer, sizeof(buffer)};
+#else
+    OutputSinks::FdSink sink{fileno(file), false, buffer, sizeof(buffer)};
+#endif
+    expected = writeMixed(sink);
+    EXPECT_TRUE(sink.flush());
+  }
+  std::fclose(file);
+
+  EXPECT_EQ(readFile(path), expected);
+  std::remove(path.c_str());
+}
+
+// Case: MappedFileSinkMixedWrites --------------------------------------------
+TEST(OutputSinksTest, MappedFileSinkMixedWrites) {
+  std::string path = testing::TempDir() + "output_sinks_test_mapped.txt";
+
+  std::string expected;
+  {
+    OutputSinks::MappedFileSink sink{path};
+    ASSERT_TRUE(sink.good());
+    // Enough data to make the mapping grow a few times
+    for (int i = 0; i < 40; ++i) {
+      expected += writeMixed(sink);
+    }
+    EXPECT_TRUE(sink.close());
+  }
+
+  EXPECT_EQ(readFile(path), expected);
+  std::remove(path.c_str());
+}
+
+
+// End of `output_sinks_test.cxx'
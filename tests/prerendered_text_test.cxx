@@ -0,0 +1,135 @@
+// ============================================================================
+//
+// File:        prerendered_text_test.cxx
+// Description: Checks the texts rendered at build time against the runtime
+//              output of the clipp based strategies
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * prerendered_text_test.cxx: created.
+// * prerendered_text_test.cxx: strategies are rendered into a memory sink.
+// * prerendered_text_test.cxx: added the usage shown on a missing argument.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "action_registry.hxx"
+#include "cli_actions.hxx"
+#include "cli_template_app.hxx"
+#include "output_sinks.hxx"
+#include "help_text.hxx"  // Generated at build time
+
+// Standard library headers
+#include <string>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Executes the strategy and returns its regular output
+template <typename Strategy>
+static std::string runtimeOutput(Strategy const& strategy)
+{
+    OutputSinks::MemorySink out;
+    OutputSinks::MemorySink err;
+    CliActions::executeStatic(PrerenderedText::kExecName, strategy, out, err);
+
+    return std::string {out.view()};
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// PrerenderedTextTest
+// ----------------------------------------------------------------------------
+//
+// Description: Pre-rendered texts must be byte-identical to what clipp
+//              renders at runtime, and emitting them must not change them.
+//
+// ----------------------------------------------------------------------------
+
+// Case: ExecName -------------------------------------------------------------
+TEST(PrerenderedTextTest, ExecName) {
+  EXPECT_EQ(PrerenderedText::kExecName, kAppName);
+}
+
+// Case: Help -----------------------------------------------------------------
+TEST(PrerenderedTextTest, Help) {
+  EXPECT_EQ(std::string {PrerenderedText::kHelp},
+    runtimeOutput(makeShowHelpStrategy()));
+}
+
+// Case: Usage ----------------------------------------------------------------
+TEST(PrerenderedTextTest, Usage) {
+  EXPECT_EQ(std::string {PrerenderedText::kUsage},
+    runtimeOutput(makeShowUsageStrategy()));
+}
+
+// Case: Version --------------------------------------------------------------
+TEST(PrerenderedTextTest, Version) {
+  EXPECT_EQ(std::string {PrerenderedText::kVersion},
+    runtimeOutput(makeShowVersionStrategy()));
+}
+
+// Case: MissingArgument ------------------------------------------------------
+TEST(PrerenderedTextTest, MissingArgument) {
+  EXPECT_EQ(
+    runtimeOutput(CliActions::MissingArgumentStrategy(
+      "missing argument",
+      PrerenderedText::kMissingArgumentUsage
+    )),
+    runtimeOutput(CliActions::MissingArgumentStrategyClipp(
+      "missing argument",
+      appOptions(),
+      CliActions::pageFormatting()
+    ))
+  );
+}
+
+// Case: StaticTextStrategy ---------------------------------------------------
+TEST(PrerenderedTextTest, StaticTextStrategy) {
+  EXPECT_EQ(
+    runtimeOutput(CliActions::ShowStaticTextStrategy(PrerenderedText::kHelp)),
+    runtimeOutput(makeShowHelpStrategy()));
+}
+
+
+// End of `prerendered_text_test.cxx'
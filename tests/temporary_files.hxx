@@ -0,0 +1,116 @@
+// ============================================================================
+//
+// File:        temporary_files.hxx
+// Description: Temporary files of the unit tests, unique to the test and to
+//              the test process
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * temporary_files.hxx: created.
+//
+// ============================================================================
+
+#pragma once
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Standard library headers
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+// System headers
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Temporary Files Section
+// ============================================================================
+
+// Path in the test temporary directory named after the running test and the
+// test process, so concurrent test processes (`ctest -j') never share one
+inline std::filesystem::path uniqueTestPath(std::string_view extension = {})
+{
+  static int counter = 0;
+
+  std::string name = "test";
+  auto const* test = testing::UnitTest::GetInstance()->current_test_info();
+  if (nullptr != test) {
+    name = std::string{test->test_suite_name()} + "." + test->name();
+    std::replace(name.begin(), name.end(), '/', '_');
+  }
+#if defined(_WIN32)
+  name += "_" + std::to_string(_getpid());
+#else
+  name += "_" + std::to_string(::getpid());
+#endif
+  name += "_" + std::to_string(++counter);
+  name.append(extension.data(), extension.size());
+
+  return std::filesystem::path{testing::TempDir()} / name;
+}
+
+// Temporary file removed by the destructor
+class TemporaryFile {
+public:
+  explicit TemporaryFile(std::string_view content)
+    : m_Path{uniqueTestPath(".txt")}
+  {
+    std::ofstream file{m_Path, std::ios::binary};
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+  }
+
+  TemporaryFile(TemporaryFile const&) = delete;
+  TemporaryFile& operator=(TemporaryFile const&) = delete;
+
+  ~TemporaryFile() {
+    std::error_code ignored;
+    std::filesystem::remove(m_Path, ignored);
+  }
+
+  std::string path() const {
+    return m_Path.string();
+  }
+
+private:
+  std::filesystem::path m_Path;
+};
+
+// End of `temporary_files.hxx'
@@ -0,0 +1,461 @@
+// ============================================================================
+//
+// File:        text_kernels_test.cxx
+// Description: Tests of every variant of the text kernels against the scalar
+//              one, and of the line counting strategy
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * text_kernels_test.cxx: created.
+// * text_kernels_test.cxx: temporary files come from temporary_files.hxx.
+// * text_kernels_test.cxx: added a case for lines longer than the chunks.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "argv_parser.hxx"
+#include "count_strategy.hxx"
+#include "output_sinks.hxx"
+#include "text_kernels.hxx"
+
+// Test headers
+#include "temporary_files.hxx"
+
+// Standard library headers
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Sizes around the block sizes of the variants, and a few large enough for
+// the byte counters of the counting kernels to be summed up more than once
+static std::vector<std::size_t> testSizes()
+{
+  std::vector<std::size_t> sizes;
+  for (std::size_t size = 0; size <= 200; ++size) {
+    sizes.push_back(size);
+  }
+  for (std::size_t size : {255u, 256u, 1000u, 4096u, 16321u, 70000u}) {
+    sizes.push_back(size);
+  }
+  return sizes;
+}
+
+// Variants supported here, the scalar one first
+static std::vector<TextKernels::Kernels const*> supportedVariants()
+{
+  std::vector<TextKernels::Kernels const*> variants;
+  for (auto isa : TextKernels::kAllIsas) {
+    if (auto const* kernels = TextKernels::variant(isa)) {
+      variants.push_back(kernels);
+    }
+  }
+  return variants;
+}
+
+// Random bytes drawn from the alphabet
+static std::string randomText(
+  std::size_t size,
+  std::string_view alphabet,
+  std::mt19937& random
+) {
+  std::uniform_int_distribution<std::size_t> pick{0, alphabet.size() - 1};
+  std::string text(size, '\0');
+  for (auto& c : text) {
+    c = alphabet[pick(random)];
+  }
+  return text;
+}
+
+static std::string randomBytes(std::size_t size, std::mt19937& random)
+{
+  std::uniform_int_distribution<int> byte{0, 255};
+  std::string text(size, '\0');
+  for (auto& c : text) {
+    c = static_cast<char>(byte(random));
+  }
+  return text;
+}
+
+// UTF-8 text of random code points of all lengths, mostly ASCII
+static std::string randomUtf8(std::size_t size, std::mt19937& random)
+{
+  std::uniform_int_distribution<int> length{1, 7};
+  std::string text;
+  while (text.size() < size) {
+    std::uint32_t code;
+    switch (length(random)) {
+    case 4:
+      code = std::uniform_int_distribution<std::uint32_t>{0x80, 0x7FF}(random);
+      break;
+    case 5:
+      do {
+        code = std::uniform_int_distribution<std::uint32_t>{
+          0x800, 0xFFFF
+        }(random);
+      } while (0xD800 <= code && code <= 0xDFFF);
+      break;
+    case 6:
+      code = std::uniform_int_distribution<std::uint32_t>{
+        0x10000, 0x10FFFF
+      }(random);
+      break;
+    default:
+      code = std::uniform_int_distribution<std::uint32_t>{0, 0x7F}(random);
+      break;
+    }
+
+    if (code < 0x80) {
+      text += static_cast<char>(code);
+    } else if (code < 0x800) {
+      text += static_cast<char>(0xC0 | code >> 6);
+      text += static_cast<char>(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+      text += static_cast<char>(0xE0 | code >> 12);
+      text += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+      text += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+      text += static_cast<char>(0xF0 | code >> 18);
+      text += static_cast<char>(0x80 | (code >> 12 & 0x3F));
+      text += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+      text += static_cast<char>(0x80 | (code & 0x3F));
+    }
+  }
+  return text;
+}
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// TextKernelsTest
+// ----------------------------------------------------------------------------
+//
+// Description: The scalar kernels give the expected results, and every
+//              variant supported by the CPU gives the same results as the
+//              scalar one on random texts of all sizes. Each text is a
+//              buffer of its own, so reads past its end are caught by the
+//              sanitizers.
+//
+// ----------------------------------------------------------------------------
+
+// Case: Selection ------------------------------------------------------------
+TEST(TextKernelsTest, Selection) {
+  auto variants = supportedVariants();
+  ASSERT_FALSE(variants.empty());
+  EXPECT_EQ(variants.front()->isa, TextKernels::Isa::Scalar);
+  // The widest supported variant is the active one
+  EXPECT_EQ(TextKernels::active().isa, variants.back()->isa);
+  std::string names;
+  for (auto const* kernels : variants) {
+    names += names.empty() ? "" : " ";
+    names += TextKernels::isaName(kernels->isa);
+  }
+  RecordProperty("variants", names);
+}
+
+// Case: ScalarReference ------------------------------------------------------
+TEST(TextKernelsTest, ScalarReference) {
+  using namespace std::string_view_literals;
+  auto const& scalar = *TextKernels::variant(TextKernels::Isa::Scalar);
+
+  std::string_view text = "one\ntwo\nthree";
+  EXPECT_EQ(scalar.findByte(text.data(), text.size(), '\n'), 3u);
+  EXPECT_EQ(scalar.findByte(text.data(), text.size(), 'x'), text.size());
+  EXPECT_EQ(scalar.countByte(text.data(), text.size(), '\n'), 2u);
+
+  std::string_view mixed = "Hello, WORLD @[`{";
+  std::string folded(mixed.size(), '\0');
+  scalar.foldCase(mixed.data(), mixed.size(), folded.data());
+  EXPECT_EQ(folded, "hello, world @[`{");
+
+  for (auto valid : {
+    ""sv, "ascii"sv, "\xC2\x80"sv, "\xDF\xBF"sv, "\xE0\xA0\x80"sv,
+    "\xED\x9F\xBF"sv, "\xEE\x80\x80"sv, "\xF0\x90\x80\x80"sv,
+    "\xF4\x8F\xBF\xBF"sv, "\0"sv
+  }) {
+    EXPECT_TRUE(scalar.validUtf8(valid.data(), valid.size()))
+      << testing::PrintToString(valid);
+  }
+  for (auto invalid : {
+    "\x80"sv, "\xBF"sv, "\xC0\x80"sv, "\xC1\xBF"sv, "\xC2"sv, "\xC2\x41"sv,
+    "\xE0\x80\x80"sv, "\xE0\x9F\xBF"sv, "\xED\xA0\x80"sv, "\xE2\x82"sv,
+    "\xF0\x80\x80\x80"sv, "\xF0\x8F\xBF\xBF"sv, "\xF4\x90\x80\x80"sv,
+    "\xF5\x80\x80\x80"sv, "\xFF"sv, "\xF0\x90\x80"sv, "\xC2\x80\x80"sv
+  }) {
+    EXPECT_FALSE(scalar.validUtf8(invalid.data(), invalid.size()))
+      << testing::PrintToString(invalid);
+  }
+}
+
+// Case: FindByte -------------------------------------------------------------
+TEST(TextKernelsTest, FindByte) {
+  auto const& scalar = *TextKernels::variant(TextKernels::Isa::Scalar);
+  std::mt19937 random{1};
+
+  for (auto const* kernels : supportedVariants()) {
+    SCOPED_TRACE(TextKernels::isaName(kernels->isa));
+    for (std::size_t size : testSizes()) {
+      // Sparse needles, and none at all
+      std::string text =
+        randomText(size, "abcdefghijklmnopqrstuvwxyz\n\xFF", random);
+      for (char byte : {'\n', '\xFF', 'a', '#'}) {
+        std::vector<char> buffer(text.begin(), text.end());
+        ASSERT_EQ(
+          kernels->findByte(buffer.data(), buffer.size(), byte),
+          scalar.findByte(buffer.data(), buffer.size(), byte)
+        ) << "size " << size << ", byte " << int(byte);
+      }
+      // A single needle at every position of short texts
+      if (size > 0 && size <= 130) {
+        std::string plain(size, 'x');
+        for (std::size_t at = 0; at < size; ++at) {
+          plain[at] = '\n';
+          EXPECT_EQ(kernels->findByte(plain.data(), size, '\n'), at);
+          plain[at] = 'x';
+        }
+      }
+    }
+  }
+}
+
+// Case: CountByte ------------------------------------------------------------
+TEST(TextKernelsTest, CountByte) {
+  auto const& scalar = *TextKernels::variant(TextKernels::Isa::Scalar);
+  std::mt19937 random{2};
+
+  for (auto const* kernels : supportedVariants()) {
+    SCOPED_TRACE(TextKernels::isaName(kernels->isa));
+    for (std::size_t size : testSizes()) {
+      for (std::string_view alphabet : {"ab\n", "\n", "abcdefgh\n\x80"}) {
+        std::string text = randomText(size, alphabet, random);
+        std::vector<char> buffer(text.begin(), text.end());
+        ASSERT_EQ(
+          kernels->countByte(buffer.data(), buffer.size(), '\n'),
+          scalar.countByte(buffer.data(), buffer.size(), '\n')
+        ) << "size " << size;
+        ASSERT_EQ(
+          kernels->countByte(buffer.data(), buffer.size(), '\x80'),
+          scalar.countByte(buffer.data(), buffer.size(), '\x80')
+        ) << "size " << size;
+      }
+    }
+  }
+}
+
+// Case: FoldCase -------------------------------------------------------------
+TEST(TextKernelsTest, FoldCase) {
+  auto const& scalar = *TextKernels::variant(TextKernels::Isa::Scalar);
+  std::mt19937 random{3};
+
+  for (auto const* kernels : supportedVariants()) {
+    SCOPED_TRACE(TextKernels::isaName(kernels->isa));
+    for (std::size_t size : testSizes()) {
+      std::string text = randomBytes(size, random);
+      std::vector<char> expected(size);
+      std::vector<char> folded(size);
+      scalar.foldCase(text.data(), size, expected.data());
+      kernels->foldCase(text.data(), size, folded.data());
+      ASSERT_EQ(folded, expected) << "size " << size;
+
+      // In place
+      std::vector<char> buffer(text.begin(), text.end());
+      kernels->foldCase(buffer.data(), size, buffer.data());
+      ASSERT_EQ(buffer, expected) << "size " << size;
+    }
+  }
+}
+
+// Case: ValidUtf8 ------------------------------------------------------------
+TEST(TextKernelsTest, ValidUtf8) {
+  auto const& scalar = *TextKernels::variant(TextKernels::Isa::Scalar);
+  std::mt19937 random{4};
+
+  for (auto const* kernels : supportedVariants()) {
+    SCOPED_TRACE(TextKernels::isaName(kernels->isa));
+    std::size_t valid = 0;
+    std::size_t invalid = 0;
+
+    for (std::size_t size : testSizes()) {
+      std::string text = randomUtf8(size, random);
+      std::vector<std::string> texts{text, randomBytes(size, random)};
+      if (!text.empty()) {
+        // A random byte changed, and the text cut at a random place
+        std::uniform_int_distribution<std::size_t> at{0, text.size() - 1};
+        std::string changed = text;
+        changed[at(random)] = static_cast<char>(random());
+        texts.push_back(changed);
+        texts.push_back(text.substr(0, at(random)));
+      }
+
+      for (auto const& sample : texts) {
+        std::vector<char> buffer(sample.begin(), sample.end());
+        bool expected = scalar.validUtf8(buffer.data(), buffer.size());
+        ASSERT_EQ(kernels->validUtf8(buffer.data(), buffer.size()), expected)
+          << testing::PrintToString(sample);
+        ++(expected ? valid : invalid);
+      }
+    }
+    EXPECT_GT(valid, 100u);
+    EXPECT_GT(invalid, 100u);
+  }
+}
+
+// Case: Utf8ErrorsAtEveryPosition --------------------------------------------
+TEST(TextKernelsTest, Utf8ErrorsAtEveryPosition) {
+  using namespace std::string_view_literals;
+  auto const& scalar = *TextKernels::variant(TextKernels::Isa::Scalar);
+
+  // Sequences around the block boundaries, after ASCII and after a valid
+  // multibyte sequence
+  for (auto const* kernels : supportedVariants()) {
+    SCOPED_TRACE(TextKernels::isaName(kernels->isa));
+    for (auto sequence : {
+      "\xC3\xA9"sv, "\xE2\x82\xAC"sv, "\xF0\x9F\x98\x80"sv,
+      "\x80"sv, "\xC0\x80"sv, "\xED\xA0\x80"sv, "\xF4\x90\x80\x80"sv,
+      "\xE2\x82"sv, "\xF0\x9F\x98"sv, "\xC3"sv, "\xE0\x9F\xBF"sv
+    }) {
+      for (std::string_view before : {"a"sv, "\xC3\xA9"sv}) {
+        for (std::size_t prefix = 0; prefix <= 140; ++prefix) {
+          for (std::size_t suffix : {0u, 1u, 70u}) {
+            std::string text(prefix, 'a');
+            if (prefix > 0) {
+              text.replace(0, before.size(), before.substr(0, prefix));
+            }
+            text += sequence;
+            text += std::string(suffix, 'z');
+            std::vector<char> buffer(text.begin(), text.end());
+            ASSERT_EQ(
+              kernels->validUtf8(buffer.data(), buffer.size()),
+              scalar.validUtf8(buffer.data(), buffer.size())
+            ) << testing::PrintToString(text);
+          }
+        }
+      }
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+// CountStrategyTest
+// ----------------------------------------------------------------------------
+//
+// Description: The counting strategy prints the line and byte counts of its
+//              inputs, with the totals when there are more inputs.
+//
+// ----------------------------------------------------------------------------
+
+// Case: CountsLines ----------------------------------------------------------
+TEST(CountStrategyTest, CountsLines) {
+  TemporaryFile file{"one\ntwo\n\nthree without an end"};
+  std::string path = file.path();
+  char const* inputs[] = {path.c_str()};
+
+  for (std::size_t chunkSize : {std::size_t{3}, std::size_t{1024}}) {
+    CliActions::InputOptions options;
+    options.chunk_size = chunkSize;
+
+    OutputSinks::MemorySink out;
+    OutputSinks::MemorySink err;
+    CountStrategy count{ArgvParser::ArgSpan{inputs, 1}, options};
+
+    EXPECT_EQ(count(CliActions::ActionContext{"app", out, err}), EXIT_SUCCESS);
+    EXPECT_EQ(out.view(), "3 29 " + path + "\n");
+    EXPECT_EQ(err.view(), "");
+  }
+}
+
+// Case: LinesLongerThanChunks ------------------------------------------------
+TEST(CountStrategyTest, LinesLongerThanChunks) {
+  std::string const text = std::string(100000, 'x') + "\n"
+    + std::string(50000, 'y');
+  TemporaryFile file{text};
+  std::string path = file.path();
+  char const* inputs[] = {path.c_str()};
+
+  for (auto backend : {"mmap", "read", "io_uring"}) {
+    SCOPED_TRACE(backend);
+    CliActions::InputOptions options;
+    options.backend = backend;
+    options.chunk_size = 4096;
+
+    OutputSinks::MemorySink out;
+    OutputSinks::MemorySink err;
+    CountStrategy count{ArgvParser::ArgSpan{inputs, 1}, options};
+
+    EXPECT_EQ(count(CliActions::ActionContext{"app", out, err}), EXIT_SUCCESS);
+    EXPECT_EQ(out.view(), "1 150001 " + path + "\n");
+  }
+}
+
+// Case: PrintsTotals ---------------------------------------------------------
+TEST(CountStrategyTest, PrintsTotals) {
+  TemporaryFile first{"a\nb\n"};
+  TemporaryFile second{""};
+  std::string paths[] = {first.path(), second.path()};
+  char const* inputs[] = {
+    paths[0].c_str(),
+    "/nonexistent/text_kernels_test.txt",
+    paths[1].c_str()
+  };
+
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+  CountStrategy count{ArgvParser::ArgSpan{inputs, 3}};
+
+  EXPECT_EQ(count(CliActions::ActionContext{"app", out, err}), EXIT_FAILURE);
+  EXPECT_EQ(
+    out.view(),
+    "2 4 " + paths[0] + "\n0 0 " + paths[1] + "\n2 4 total\n"
+  );
+  EXPECT_NE(err.view().find("app: /nonexistent/text_kernels_test.txt: "),
+    std::string_view::npos);
+}
+
+
+// End of `text_kernels_test.cxx'
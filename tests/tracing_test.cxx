@@ -0,0 +1,209 @@
+// ============================================================================
+//
+// File:        tracing_test.cxx
+// Description: Unit tests for the phase tracing
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * tracing_test.cxx: created.
+//
+// ============================================================================
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "output_sinks.hxx"
+#include "tracing.hxx"
+
+// Standard library headers
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Every test starts with empty rings and the tracing disabled
+class TracingTest : public testing::Test {
+protected:
+  void SetUp() override {
+    Tracing::setEnabled(false);
+    Tracing::reset();
+  }
+
+  void TearDown() override {
+    Tracing::setEnabled(false);
+  }
+};
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// TracingTest
+// ----------------------------------------------------------------------------
+//
+// Description: Timers record only while the tracing is enabled, every thread
+//              records into its own bounded ring, and the collected events
+//              are exported in the Chrome trace event format.
+//
+// ----------------------------------------------------------------------------
+
+// Case: DisabledRecordsNothing -----------------------------------------------
+TEST_F(TracingTest, DisabledRecordsNothing) {
+  {
+    Tracing::ScopedTimer timer{"disabled"};
+  }
+  EXPECT_TRUE(Tracing::collect().empty());
+}
+
+// Case: NestedScopes ---------------------------------------------------------
+TEST_F(TracingTest, NestedScopes) {
+  Tracing::setEnabled(true);
+  {
+    Tracing::ScopedTimer outer{"outer"};
+    Tracing::ScopedTimer inner{"inner"};
+  }
+  Tracing::setEnabled(false);
+
+  auto events = Tracing::collect();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_STREQ(events[0].event.name, "outer");
+  EXPECT_STREQ(events[1].event.name, "inner");
+  EXPECT_LE(events[0].event.start, events[1].event.start);
+  EXPECT_LE(
+    events[1].event.start + events[1].event.duration,
+    events[0].event.start + events[0].event.duration);
+}
+
+// Case: RingOverwritesOldest -------------------------------------------------
+TEST_F(TracingTest, RingOverwritesOldest) {
+  constexpr std::size_t kExtra = 10;
+  for (std::size_t i = 0; i < Tracing::DEFAULT_RING_CAPACITY + kExtra; ++i) {
+    Tracing::record("event", i, i + 1);
+  }
+
+  std::size_t dropped = 0;
+  auto events = Tracing::collect(&dropped);
+  ASSERT_EQ(events.size(), Tracing::DEFAULT_RING_CAPACITY);
+  EXPECT_EQ(dropped, kExtra);
+  EXPECT_EQ(events.front().event.start, kExtra);
+}
+
+// Case: ThreadsRecordIntoOwnRings --------------------------------------------
+TEST_F(TracingTest, ThreadsRecordIntoOwnRings) {
+  constexpr int kThreads = 4;
+  constexpr int kEventsPerThread = 100;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([] {
+      for (int i = 0; i < kEventsPerThread; ++i) {
+        Tracing::record("worker", 0, 1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto events = Tracing::collect();
+  ASSERT_EQ(events.size(), std::size_t {kThreads * kEventsPerThread});
+  std::set<std::uint32_t> ids;
+  for (auto const& item : events) {
+    ids.insert(item.thread);
+  }
+  EXPECT_EQ(ids.size(), std::size_t {kThreads});
+}
+
+// Case: ChromeTraceFormat ----------------------------------------------------
+TEST_F(TracingTest, ChromeTraceFormat) {
+  std::vector<Tracing::CollectedEvent> events{
+    {{"a \"quoted\" name", 1234, 5007}, 1}
+  };
+  OutputSinks::MemorySink sink;
+  Tracing::writeChromeTrace(sink, events, 3);
+
+  std::string_view json = sink.view();
+  EXPECT_EQ(json.find("{\"traceEvents\":["), 0u);
+  EXPECT_NE(json.find("\"name\":\"a \\\"quoted\\\" name\""), json.npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), json.npos);
+  EXPECT_NE(json.find("\"tid\":1,\"ts\":1.234,\"dur\":5.007}"), json.npos);
+  EXPECT_NE(json.find("\"droppedEvents\":3"), json.npos);
+}
+
+// Case: SummaryTable ---------------------------------------------------------
+TEST_F(TracingTest, SummaryTable) {
+  std::vector<Tracing::CollectedEvent> events{
+    {{"short", 0, 1000}, 1},
+    {{"long", 0, 9000}, 1},
+    {{"short", 0, 3000}, 1}
+  };
+  OutputSinks::MemorySink sink;
+  Tracing::writeSummary(sink, events);
+
+  std::string_view table = sink.view();
+  auto longRow = table.find("long");
+  auto shortRow = table.find("short");
+  ASSERT_NE(longRow, table.npos);
+  ASSERT_NE(shortRow, table.npos);
+  EXPECT_LT(longRow, shortRow);  // Sorted by the total time
+  EXPECT_NE(table.find("2         4.000         2.000         3.000"),
+    table.npos);
+}
+
+// Case: TraceFileFromCommandLine ---------------------------------------------
+TEST_F(TracingTest, TraceFileFromCommandLine) {
+  std::string args[] = {"app", "--trace=first.json", "-h", "--trace=t.json"};
+  char* argv[] = {
+    args[0].data(), args[1].data(), args[2].data(), args[3].data(), nullptr
+  };
+  int argc = 4;
+
+  EXPECT_EQ(Tracing::traceFileFromCommandLine(argc, argv, nullptr), "t.json");
+  ASSERT_EQ(argc, 2);
+  EXPECT_STREQ(argv[0], "app");
+  EXPECT_STREQ(argv[1], "-h");
+  EXPECT_EQ(argv[2], nullptr);
+}
+
+
+// End of `tracing_test.cxx'
@@ -0,0 +1,446 @@
+// ============================================================================
+//
+// File:        tree_walker_test.cxx
+// Description: Unit tests for the parallel directory walk and the walk
+//              strategy
+//
+// This file is part of `C++ Playground'
+//
+// Copyright (C) 2026 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// ============================================================================
+
+// ============================================================================
+//
+// 2026-10-17 Ljubomir Kurij <ljubomir_kurij@proton.me>
+//
+// * tree_walker_test.cxx: created.
+// * tree_walker_test.cxx: the tree root comes from temporary_files.hxx.
+// * tree_walker_test.cxx: added cases for the limit of the jobs.
+// * tree_walker_test.cxx: added a case for the streamed, unsorted listing.
+//
+// ============================================================================
+
+
+
+// ============================================================================
+// Headers Include Section
+// ============================================================================
+
+// Project library headers
+#include "argv_parser.hxx"
+#include "cli_actions.hxx"
+#include "output_sinks.hxx"
+#include "tree_walker.hxx"
+#include "walk_strategy.hxx"
+
+// Test headers
+#include "temporary_files.hxx"
+
+// Standard library headers
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+// External libraries headers
+#include <gtest/gtest.h>  // GoogleTest framework
+
+
+// ============================================================================
+// Test fixtures section
+// ============================================================================
+
+// Directory tree of `fanout' subdirectories per level, `depth' levels deep,
+// with a few files of different sizes in every directory. Removed by the
+// destructor.
+class TemporaryTree {
+public:
+  TemporaryTree(int depth, int fanout) : m_Root{uniqueTestPath()} {
+    populate(m_Root, depth, fanout);
+  }
+
+  ~TemporaryTree() {
+    std::error_code ignored;
+    std::filesystem::remove_all(m_Root, ignored);
+  }
+
+  std::filesystem::path const& root() const {
+    return m_Root;
+  }
+
+  std::string path() const {
+    return m_Root.string();
+  }
+
+  static void writeFile(std::filesystem::path const& path, std::size_t size) {
+    std::ofstream file{path, std::ios::binary};
+    file << std::string(size, 'x');
+  }
+
+private:
+  static void populate(
+    std::filesystem::path const& directory,
+    int depth,
+    int fanout
+  ) {
+    std::filesystem::create_directories(directory);
+    for (int i = 0; i < 3; ++i) {
+      writeFile(
+        directory / ("file" + std::to_string(i)),
+        static_cast<std::size_t>(depth * 10 + i)
+      );
+    }
+    if (0 < depth) {
+      for (int i = 0; i < fanout; ++i) {
+        populate(directory / ("dir" + std::to_string(i)), depth - 1, fanout);
+      }
+    }
+  }
+
+  std::filesystem::path m_Root;
+};
+
+// Collects the visited paths, counting its forks and merges
+class CollectingVisitor : public TreeWalker::FileVisitor {
+public:
+  std::unique_ptr<TreeWalker::FileVisitor> fork() const override {
+    ++m_Forks;
+    return std::make_unique<CollectingVisitor>();
+  }
+
+  void visit(std::filesystem::directory_entry const& entry) override {
+    m_Paths.push_back(entry.path().string());
+  }
+
+  void merge(TreeWalker::FileVisitor& fork) override {
+    auto& paths = static_cast<CollectingVisitor&>(fork).m_Paths;
+    m_Paths.insert(m_Paths.end(), paths.begin(), paths.end());
+    ++m_Merges;
+  }
+
+  std::vector<std::string> sortedPaths() const {
+    std::vector<std::string> paths{m_Paths};
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  }
+
+  mutable int m_Forks{0};
+  int m_Merges{0};
+
+private:
+  std::vector<std::string> m_Paths;
+};
+
+// Paths of the entries under the root that are not directories, sorted
+static std::vector<std::string> expectedPaths(
+  std::filesystem::path const& root
+) {
+  std::vector<std::string> paths;
+  using std::filesystem::recursive_directory_iterator;
+  for (auto const& entry : recursive_directory_iterator{root}) {
+    if (entry.is_symlink() || !entry.is_directory()) {
+      paths.push_back(entry.path().string());
+    }
+  }
+  std::sort(paths.begin(), paths.end());
+  return paths;
+}
+
+static std::size_t directoryCount(std::filesystem::path const& root)
+{
+  std::size_t count = 1;
+  using std::filesystem::recursive_directory_iterator;
+  for (auto const& entry : recursive_directory_iterator{root}) {
+    if (!entry.is_symlink() && entry.is_directory()) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// Runs the walk strategy, returning the status and both outputs
+struct WalkRun {
+  int status;
+  std::string out;
+  std::string err;
+};
+
+static WalkRun runWalk(
+  std::vector<char const*> const& roots,
+  std::string_view jobs,
+  bool sorted
+) {
+  OutputSinks::MemorySink out;
+  OutputSinks::MemorySink err;
+  CliActions::ActionContext action{"walk", out, err};
+  WalkStrategy strategy{
+    ArgvParser::ArgSpan{roots.data(), roots.size()},
+    jobs,
+    sorted
+  };
+  int status = strategy(action);
+  return WalkRun{status, std::string{out.view()}, std::string{err.view()}};
+}
+
+static constexpr unsigned kJobs[] = {1, 2, 3, 8};
+
+
+// ============================================================================
+// Test cases section
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// TreeWalkerTest
+// ----------------------------------------------------------------------------
+//
+// Description: Every file under the roots is visited exactly once, whatever
+//              the number of workers, and every worker visits through a
+//              fork of its own that is merged back at the end.
+//
+// ----------------------------------------------------------------------------
+
+// Case: VisitsEveryFileOnce --------------------------------------------------
+TEST(TreeWalkerTest, VisitsEveryFileOnce) {
+  TemporaryTree tree{3, 4};
+  std::string const root = tree.path();
+  char const* roots[] = {root.c_str()};
+  auto const expected = expectedPaths(tree.root());
+
+  for (auto jobs : kJobs) {
+    SCOPED_TRACE("jobs " + std::to_string(jobs));
+    CollectingVisitor visitor;
+    auto stats = TreeWalker::walk(ArgvParser::ArgSpan{roots, 1}, visitor, jobs);
+
+    EXPECT_EQ(visitor.sortedPaths(), expected);
+    EXPECT_EQ(stats.files, expected.size());
+    EXPECT_EQ(stats.directories, directoryCount(tree.root()));
+    EXPECT_TRUE(stats.errors.empty());
+    EXPECT_EQ(visitor.m_Forks, static_cast<int>(jobs));
+    EXPECT_EQ(visitor.m_Merges, static_cast<int>(jobs));
+  }
+}
+
+// Case: DefaultJobs ----------------------------------------------------------
+TEST(TreeWalkerTest, DefaultJobs) {
+  TemporaryTree tree{1, 2};
+  std::string const root = tree.path();
+  char const* roots[] = {root.c_str()};
+
+  EXPECT_LE(1u, TreeWalker::defaultJobs());
+  CollectingVisitor visitor;
+  TreeWalker::walk(ArgvParser::ArgSpan{roots, 1}, visitor);
+  EXPECT_EQ(visitor.m_Forks, static_cast<int>(TreeWalker::defaultJobs()));
+  EXPECT_EQ(visitor.sortedPaths(), expectedPaths(tree.root()));
+}
+
+// Case: JobsAreClamped -------------------------------------------------------
+TEST(TreeWalkerTest, JobsAreClamped) {
+  TemporaryTree tree{1, 2};
+  std::string const root = tree.path();
+  char const* roots[] = {root.c_str()};
+
+  EXPECT_LE(TreeWalker::defaultJobs(), TreeWalker::maxJobs());
+  CollectingVisitor visitor;
+  TreeWalker::walk(ArgvParser::ArgSpan{roots, 1}, visitor, 4000000000u);
+  EXPECT_EQ(visitor.m_Forks, static_cast<int>(TreeWalker::maxJobs()));
+  EXPECT_EQ(visitor.sortedPaths(), expectedPaths(tree.root()));
+}
+
+// Case: FileAndMissingRoots --------------------------------------------------
+TEST(TreeWalkerTest, FileAndMissingRoots) {
+  TemporaryTree tree{1, 2};
+  std::string const directory = (tree.root() / "dir0").string();
+  std::string const file = (tree.root() / "file0").string();
+  std::string const missing = (tree.root() / "missing").string();
+  char const* roots[] = {directory.c_str(), missing.c_str(), file.c_str()};
+
+  for (auto jobs : kJobs) {
+    SCOPED_TRACE("jobs " + std::to_string(jobs));
+    CollectingVisitor visitor;
+    auto stats = TreeWalker::walk(ArgvParser::ArgSpan{roots, 3}, visitor, jobs);
+
+    auto expected = expectedPaths(directory);
+    expected.push_back(file);
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(visitor.sortedPaths(), expected);
+    EXPECT_EQ(stats.directories, 1u);
+    ASSERT_EQ(stats.errors.size(), 1u);
+    EXPECT_EQ(stats.errors.front().path, missing);
+    EXPECT_EQ(
+      stats.errors.front().error,
+      std::make_error_code(std::errc::no_such_file_or_directory)
+    );
+  }
+}
+
+#if !defined(_WIN32)
+
+// Case: SymlinksAreNotFollowed -----------------------------------------------
+TEST(TreeWalkerTest, SymlinksAreNotFollowed) {
+  TemporaryTree tree{1, 2};
+  // A cycle, the walk would never end if it followed the link
+  std::filesystem::create_directory_symlink(
+    tree.root(),
+    tree.root() / "dir0" / "loop"
+  );
+  std::string const root = tree.path();
+  char const* roots[] = {root.c_str()};
+
+  for (auto jobs : kJobs) {
+    SCOPED_TRACE("jobs " + std::to_string(jobs));
+    CollectingVisitor visitor;
+    auto stats = TreeWalker::walk(ArgvParser::ArgSpan{roots, 1}, visitor, jobs);
+    EXPECT_EQ(visitor.sortedPaths(), expectedPaths(tree.root()));
+    EXPECT_EQ(stats.directories, 3u);
+  }
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// WalkStrategyTest
+// ----------------------------------------------------------------------------
+//
+// Description: The walk strategy lists the files with their sizes, in the
+//              same order on any number of workers when sorted. Unsorted
+//              listings are streamed by the workers, a whole line at a time.
+//
+// ----------------------------------------------------------------------------
+
+// Case: SortedListing --------------------------------------------------------
+TEST(WalkStrategyTest, SortedListing) {
+  TemporaryTree tree{1, 1};
+  std::string const root = tree.path();
+  auto const path = [&](std::string_view name) {
+    std::filesystem::path relative{name};
+    return (tree.root() / relative.make_preferred()).string();
+  };
+
+  std::string const expected = "0 " + path("dir0/file0") + "\n"
+    + "1 " + path("dir0/file1") + "\n"
+    + "2 " + path("dir0/file2") + "\n"
+    + "10 " + path("file0") + "\n"
+    + "11 " + path("file1") + "\n"
+    + "12 " + path("file2") + "\n"
+    + "36 total\n";
+
+  for (auto jobs : {"1", "2", "8", ""}) {
+    SCOPED_TRACE(std::string{"jobs '"} + jobs + "'");
+    auto run = runWalk({root.c_str()}, jobs, true);
+    EXPECT_EQ(run.status, EXIT_SUCCESS);
+    EXPECT_EQ(run.out, expected);
+    EXPECT_EQ(run.err, "");
+  }
+}
+
+// Case: DeterministicWhenSorted ----------------------------------------------
+TEST(WalkStrategyTest, DeterministicWhenSorted) {
+  TemporaryTree tree{3, 5};
+  std::string const root = tree.path();
+
+  auto const reference = runWalk({root.c_str()}, "1", true);
+  ASSERT_EQ(reference.status, EXIT_SUCCESS);
+  for (int run = 0; run < 5; ++run) {
+    SCOPED_TRACE("run " + std::to_string(run));
+    EXPECT_EQ(runWalk({root.c_str()}, "8", true).out, reference.out);
+  }
+
+  // Unsorted listings hold the same lines
+  auto unsorted = runWalk({root.c_str()}, "8", false);
+  EXPECT_EQ(unsorted.out.size(), reference.out.size());
+}
+
+// Case: UnsortedListing ------------------------------------------------------
+TEST(WalkStrategyTest, UnsortedListing) {
+  // Enough files to fill the listing buffers of the workers many times
+  TemporaryTree tree{3, 6};
+  std::string const root = tree.path();
+
+  auto const lines = [](std::string const& text) {
+    std::vector<std::string> lines;
+    std::istringstream stream{text};
+    for (std::string line; std::getline(stream, line);) {
+      lines.push_back(line);
+    }
+    std::sort(lines.begin(), lines.end());
+    return lines;
+  };
+
+  auto const reference = runWalk({root.c_str()}, "1", true);
+  ASSERT_EQ(reference.status, EXIT_SUCCESS);
+  for (auto jobs : {"1", "2", "8"}) {
+    SCOPED_TRACE(std::string{"jobs '"} + jobs + "'");
+    auto run = runWalk({root.c_str()}, jobs, false);
+    EXPECT_EQ(run.status, EXIT_SUCCESS);
+    EXPECT_EQ(lines(run.out), lines(reference.out));
+
+    // The total comes last
+    auto const total = reference.out.rfind('\n', reference.out.size() - 2);
+    EXPECT_EQ(
+      run.out.substr(run.out.size() - (reference.out.size() - total)),
+      reference.out.substr(total)
+    );
+  }
+}
+
+// Case: ReportsErrors --------------------------------------------------------
+TEST(WalkStrategyTest, ReportsErrors) {
+  TemporaryTree tree{0, 0};
+  std::string const root = tree.path();
+  std::string const missing = (tree.root() / "missing").string();
+
+  auto run = runWalk({root.c_str(), missing.c_str()}, "2", true);
+  EXPECT_EQ(run.status, EXIT_FAILURE);
+  EXPECT_EQ(run.out.substr(run.out.size() - 8), "3 total\n");
+  EXPECT_EQ(run.err.rfind("walk: " + missing + ": ", 0), 0u);
+}
+
+// Case: InvalidJobs ----------------------------------------------------------
+TEST(WalkStrategyTest, InvalidJobs) {
+  TemporaryTree tree{0, 0};
+  std::string const root = tree.path();
+
+  std::vector<std::string> const invalid{
+    "0", "-1", "x", "2x", "99999999999", "4000000000",
+    std::to_string(TreeWalker::maxJobs() + 1)
+  };
+  for (auto const& jobs : invalid) {
+    SCOPED_TRACE(jobs);
+    auto run = runWalk({root.c_str()}, jobs, false);
+    EXPECT_EQ(run.status, EXIT_FAILURE);
+    EXPECT_EQ(run.out, "");
+    EXPECT_EQ(
+      run.err,
+      "walk: ERROR: invalid number of jobs '" + jobs + "'\n"
+    );
+  }
+}
+
+
+// End of `tree_walker_test.cxx'